@@ -0,0 +1,157 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.hpp"
+#include <cstdio>
+#include <cstring>
+
+namespace benchmark
+{
+	Timer::Timer()
+	{
+		restart();
+	}
+
+	void Timer::restart()
+	{
+		start = std::clock();
+	}
+
+	double Timer::getMilliseconds() const
+	{
+		return double(std::clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+	}
+
+	HeadlessGui::HeadlessGui( int width, int height )
+		: graphics(width,height)
+	{
+		gui.setGraphics(&graphics);
+		gui.setInput(&input);
+		gui.setCursorProvider(&cursorProvider);
+		gui.getTop()->setSize(width,height);
+	}
+
+	agui::Gui& HeadlessGui::getGui()
+	{
+		return gui;
+	}
+
+	agui::SoftwareInput& HeadlessGui::getInput()
+	{
+		return input;
+	}
+
+	agui::SoftwareGraphics& HeadlessGui::getGraphics()
+	{
+		return graphics;
+	}
+
+	void HeadlessGui::tick()
+	{
+		input.advanceTime(1.0 / 60.0);
+		gui.logic();
+	}
+
+	void HeadlessGui::render()
+	{
+		if(!gui.isDirtyRendering())
+		{
+			graphics.clear(gui.getTop()->getBackColor());
+		}
+		gui.render();
+	}
+
+	void report( const std::string &benchmark, const std::string &scenario,
+		int size, double value, const std::string &unit )
+	{
+		printf("%-12s %-28s %8d %12.3f %s\n",benchmark.c_str(),
+			scenario.c_str(),size,value,unit.c_str());
+	}
+}
+
+namespace
+{
+	struct BenchmarkEntry
+	{
+		const char* name;
+		void (*run)();
+	};
+
+	const BenchmarkEntry benchmarks[] =
+	{
+		{"textbox",benchmark::runTextBoxBenchmark},
+		{"font",benchmark::runFontBenchmark},
+		{"mouse",benchmark::runMouseBenchmark},
+		{"scrollpane",benchmark::runScrollPaneBenchmark},
+		{"clipping",benchmark::runClippingBenchmark},
+		{"flowlayout",benchmark::runFlowLayoutBenchmark}
+	};
+}
+
+/*
+ * Runs every benchmark, or only the ones named on the command line.
+ */
+int main(int argc, char* argv[])
+{
+	agui::SoftwareFont font("builtin",16);
+	agui::Widget::setGlobalFont(&font);
+
+	printf("%-12s %-28s %8s %12s\n","benchmark","scenario","size","value");
+
+	int count = int(sizeof(benchmarks) / sizeof(benchmarks[0]));
+	for(int i = 0; i < count; ++i)
+	{
+		bool wanted = argc <= 1;
+		for(int j = 1; j < argc; ++j)
+		{
+			if(strcmp(argv[j],benchmarks[i].name) == 0)
+			{
+				wanted = true;
+			}
+		}
+
+		if(wanted)
+		{
+			benchmarks[i].run();
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_BENCHMARK_HPP
+#define AGUI_BENCHMARK_HPP
+
+#include "Agui/Agui.hpp"
+#include "Agui/Backends/Software/Software.hpp"
+#include <ctime>
+#include <string>
+
+namespace benchmark
+{
+	/**
+     * Measures processor time in milliseconds.
+     */
+	class Timer
+	{
+		std::clock_t start;
+	public:
+		Timer();
+	/**
+     * Starts measuring again from now.
+     */
+		void restart();
+	/**
+     * @return The milliseconds since the Timer was made or restarted.
+     */
+		double getMilliseconds() const;
+	};
+
+	/**
+     * A Gui that renders into a software display and reads scripted input,
+	 * so a benchmark runs the same way on every machine and without a window.
+     */
+	class HeadlessGui
+	{
+		agui::SoftwareGraphics graphics;
+		agui::SoftwareInput input;
+		agui::SoftwareCursorProvider cursorProvider;
+		agui::Gui gui;
+	public:
+		HeadlessGui(int width, int height);
+		agui::Gui& getGui();
+		agui::SoftwareInput& getInput();
+		agui::SoftwareGraphics& getGraphics();
+	/**
+     * Moves the input clock forward by one 60 Hz frame and calls Gui::logic.
+     */
+		void tick();
+	/**
+     * Clears the display and calls Gui::render.
+     */
+		void render();
+	};
+
+	/**
+     * Prints one result line: the benchmark, the scenario, its size and the value.
+     */
+	void report(const std::string &benchmark, const std::string &scenario,
+		int size, double value, const std::string &unit);
+
+	void runTextBoxBenchmark();
+	void runFontBenchmark();
+	void runMouseBenchmark();
+	void runScrollPaneBenchmark();
+	void runClippingBenchmark();
+	void runFlowLayoutBenchmark();
+}
+
+#endif
@@ -0,0 +1,117 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.hpp"
+#include "Agui/EmptyWidget.hpp"
+#include <vector>
+
+namespace benchmark
+{
+	/*
+	 * Repaints columns of nested widgets of growing depth, so the time
+	 * per frame shows how clipping scales with the depth of the tree.
+	 * The baseline also calls Widget::clip for every widget, which rebuilds
+	 * the whole clipping stack from the root like painting used to.
+	 */
+	void runClippingBenchmark()
+	{
+		const int depths[] = {20,35,50};
+		const int columns = 40;
+		const int frames = 100;
+
+		for(int d = 0; d < 3; ++d)
+		{
+			HeadlessGui headless(800,600);
+
+			std::vector<agui::Widget*> widgets;
+			for(int c = 0; c < columns; ++c)
+			{
+				agui::Widget* parent = NULL;
+				for(int i = 0; i < depths[d]; ++i)
+				{
+					agui::EmptyWidget* widget = new agui::EmptyWidget();
+					if(parent)
+					{
+						widget->setLocation(0,5);
+						widget->setSize(20,parent->getInnerHeight() - 5);
+						parent->add(widget);
+					}
+					else
+					{
+						widget->setLocation(c * 20,0);
+						widget->setSize(20,600);
+						headless.getGui().add(widget);
+					}
+					widgets.push_back(widget);
+					parent = widget;
+				}
+			}
+
+			Timer timer;
+			for(int i = 0; i < frames; ++i)
+			{
+				headless.render();
+			}
+
+			report("clipping","repaint nested columns",depths[d],
+				timer.getMilliseconds() / frames,"ms");
+
+			agui::SoftwareGraphics &graphics = headless.getGraphics();
+			timer.restart();
+			for(int i = 0; i < frames; ++i)
+			{
+				headless.render();
+				for(size_t w = 0; w < widgets.size(); ++w)
+				{
+					widgets[w]->clip(agui::PaintEvent(true,&graphics));
+				}
+				graphics.clearClippingStack();
+			}
+
+			report("clipping","repaint with full clips",depths[d],
+				timer.getMilliseconds() / frames,"ms");
+
+			for(size_t i = widgets.size(); i > 0; --i)
+			{
+				delete widgets[i - 1];
+			}
+		}
+	}
+}
@@ -0,0 +1,97 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.hpp"
+#include "Agui/FlowLayout.hpp"
+#include "Agui/EmptyWidget.hpp"
+#include <vector>
+
+namespace benchmark
+{
+	/*
+	 * Resizes a FlowLayout of growing numbers of children so every child
+	 * moves, then runs a tick with the mouse over the layout, and reports
+	 * the time of one relayout and the hover re-evaluation that follows.
+	 */
+	void runFlowLayoutBenchmark()
+	{
+		const int sizes[] = {1000,5000};
+		const int relayouts = 100;
+
+		for(int s = 0; s < 2; ++s)
+		{
+			HeadlessGui headless(800,600);
+			agui::FlowLayout flow;
+			flow.setResizeToParent(false);
+			flow.setSize(800,600);
+			headless.getGui().add(&flow);
+
+			std::vector<agui::Widget*> widgets;
+			flow.suspendLayout();
+			for(int i = 0; i < sizes[s]; ++i)
+			{
+				agui::EmptyWidget* widget = new agui::EmptyWidget();
+				widget->setSize(8,8);
+				flow.add(widget);
+				widgets.push_back(widget);
+			}
+			flow.resumeLayout();
+
+			agui::SoftwareInput &input = headless.getInput();
+			input.scheduleMouseMove(input.getTime(),400,300);
+			headless.tick();
+
+			Timer timer;
+			for(int i = 0; i < relayouts; ++i)
+			{
+				flow.setSize(600 + (i % 2) * 200,600);
+				headless.tick();
+			}
+
+			report("flowlayout","resize and tick",sizes[s],
+				timer.getMilliseconds() / relayouts,"ms");
+
+			for(size_t i = widgets.size(); i > 0; --i)
+			{
+				delete widgets[i - 1];
+			}
+		}
+	}
+}
@@ -0,0 +1,139 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.hpp"
+#include "Agui/Widgets/TextField/TextField.hpp"
+#include "Agui/FlowLayout.hpp"
+#include <vector>
+
+namespace benchmark
+{
+	/*
+	 * Measures every prefix of strings of growing length, once with a
+	 * getTextWidth call per character and once with getPrefixWidths, which
+	 * reads the cached glyph advances. Then types into the middle of a
+	 * TextField holding the same string. The TextField sits in a layout,
+	 * which listens to it like in most interfaces.
+	 */
+	void runFontBenchmark()
+	{
+		const int sizes[] = {1000,10000,100000};
+		const int repeats = 10;
+
+		for(int s = 0; s < 3; ++s)
+		{
+			std::string text;
+			for(int i = 0; i < sizes[s]; ++i)
+			{
+				text += char('a' + (i * 7) % 26);
+				if(i % 9 == 8)
+				{
+					text[text.length() - 1] = ' ';
+				}
+			}
+
+			agui::SoftwareFont font("builtin",16);
+			agui::UTF8 unicodeFunctions;
+			int checksum = 0;
+
+			Timer timer;
+			for(int r = 0; r < repeats; ++r)
+			{
+				int width = 0;
+				size_t index = 0;
+				while(index < text.length())
+				{
+					size_t start = index;
+					size_t length = unicodeFunctions.bringToNextUnichar(index,text);
+					width += font.getTextWidth(text.substr(start,length));
+				}
+				checksum += width;
+			}
+			report("font","getTextWidth per character",sizes[s],
+				timer.getMilliseconds() / repeats,"ms");
+
+			std::vector<int> widths;
+			timer.restart();
+			for(int r = 0; r < repeats; ++r)
+			{
+				font.getPrefixWidths(text,widths);
+				checksum -= widths.back();
+			}
+			report("font","getPrefixWidths",sizes[s],
+				timer.getMilliseconds() / repeats,"ms");
+
+			if(checksum != 0)
+			{
+				report("font","width mismatch",sizes[s],checksum,"px");
+			}
+
+			HeadlessGui headless(640,480);
+			agui::FlowLayout layout;
+			layout.setSize(640,480);
+			agui::TextField textField;
+			textField.setSize(400,30);
+			textField.setMaxLength(sizes[s] * 2);
+			textField.setText(text);
+			layout.add(&textField);
+			headless.getGui().add(&layout);
+			textField.focus();
+			textField.setSelection(sizes[s] / 2,sizes[s] / 2);
+			headless.render();
+
+			const int keystrokes = 200;
+			agui::SoftwareInput &input = headless.getInput();
+			for(int i = 0; i < keystrokes; ++i)
+			{
+				input.scheduleKeyPress(input.getTime() + (i + 1) / 60.0,
+					agui::KEY_A,'a');
+			}
+
+			timer.restart();
+			for(int i = 0; i < keystrokes; ++i)
+			{
+				headless.tick();
+			}
+			report("font","TextField keystroke",sizes[s],
+				timer.getMilliseconds() * 1000.0 / keystrokes,"us");
+
+			headless.getGui().remove(&layout);
+		}
+	}
+}
@@ -0,0 +1,111 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.hpp"
+#include "Agui/EmptyWidget.hpp"
+#include <vector>
+
+namespace benchmark
+{
+	/*
+	 * Moves the mouse over trees of growing size, with the widget
+	 * existence checks on and off, and reports the time per mouse move.
+	 * The rows handle the logic of their cells, so Gui::logic does not
+	 * visit every widget and the time is spent dispatching the move.
+	 */
+	void runMouseBenchmark()
+	{
+		const int sizes[] = {1000,5000,20000};
+		const int rows = 50;
+		const int moves = 500;
+
+		for(int s = 0; s < 3; ++s)
+		{
+			for(int check = 1; check >= 0; --check)
+			{
+				HeadlessGui headless(800,600);
+				headless.getGui().setExistanceCheck(check != 0);
+
+				std::vector<agui::Widget*> widgets;
+				int columns = sizes[s] / rows;
+				for(int r = 0; r < rows; ++r)
+				{
+					agui::EmptyWidget* row = new agui::EmptyWidget();
+					row->setLocation(0,r * 12);
+					row->setSize(800,12);
+					row->setHandleChildlogic(true);
+					headless.getGui().add(row);
+					widgets.push_back(row);
+
+					for(int c = 0; c < columns; ++c)
+					{
+						agui::EmptyWidget* cell = new agui::EmptyWidget();
+						cell->setLocation((c * 800) / columns,1);
+						cell->setSize(800 / columns + 1,10);
+						row->add(cell);
+						widgets.push_back(cell);
+					}
+				}
+
+				agui::SoftwareInput &input = headless.getInput();
+				for(int i = 0; i < moves; ++i)
+				{
+					input.scheduleMouseMove(input.getTime() + (i + 1) / 60.0,
+						(i * 37) % 800,(i * 53) % 600);
+				}
+
+				Timer timer;
+				for(int i = 0; i < moves; ++i)
+				{
+					headless.tick();
+				}
+
+				report("mouse",check ? "move, existence checks" :
+					"move, no existence checks",sizes[s],
+					timer.getMilliseconds() * 1000.0 / moves,"us");
+
+				for(size_t i = widgets.size(); i > 0; --i)
+				{
+					delete widgets[i - 1];
+				}
+			}
+		}
+	}
+}
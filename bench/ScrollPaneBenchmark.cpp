@@ -0,0 +1,106 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.hpp"
+#include "Agui/Widgets/ScrollPane/ScrollPane.hpp"
+#include "Agui/Widgets/Label/Label.hpp"
+#include <cstdio>
+#include <vector>
+
+namespace benchmark
+{
+	/*
+	 * Scrolls a ScrollPane of growing numbers of rows, of which about
+	 * 30 are visible, and repaints the whole display every frame.
+	 */
+	void runScrollPaneBenchmark()
+	{
+		const int sizes[] = {1000,10000,50000};
+		const int frames = 100;
+
+		for(int s = 0; s < 3; ++s)
+		{
+			HeadlessGui headless(640,480);
+			agui::HScrollBar hScroll;
+			agui::VScrollBar vScroll;
+			agui::ScrollPane scrollPane(&hScroll,&vScroll);
+			scrollPane.setSize(400,460);
+			scrollPane.setLocation(10,10);
+			headless.getGui().add(&scrollPane);
+
+			std::vector<agui::Label*> rows;
+			scrollPane.beginUpdate();
+			for(int i = 0; i < sizes[s]; ++i)
+			{
+				char text[32];
+				sprintf(text,"Row %d",i);
+				agui::Label* row = new agui::Label(text);
+				row->setLocation(0,i * 15);
+				row->setSize(360,15);
+				scrollPane.add(row);
+				rows.push_back(row);
+			}
+			scrollPane.endUpdate();
+
+			int painted = 0;
+			int culled = 0;
+			Timer timer;
+			for(int i = 0; i < frames; ++i)
+			{
+				vScroll.setValue((vScroll.getMaxValue() / frames) * i);
+				headless.render();
+				painted += headless.getGui().getPaintedWidgetCount();
+				culled += headless.getGui().getCulledWidgetCount();
+			}
+
+			report("scrollpane","scroll and repaint",sizes[s],
+				timer.getMilliseconds() / frames,"ms");
+			report("scrollpane","widgets painted per frame",sizes[s],
+				double(painted) / frames,"");
+			report("scrollpane","subtrees culled per frame",sizes[s],
+				double(culled) / frames,"");
+
+			for(size_t i = rows.size(); i > 0; --i)
+			{
+				delete rows[i - 1];
+			}
+		}
+	}
+}
@@ -0,0 +1,104 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.hpp"
+#include "Agui/Widgets/TextBox/TextBox.hpp"
+#include <cstdio>
+
+namespace benchmark
+{
+	/*
+	 * Types into the middle of word wrapped documents of growing size and
+	 * reports the time per keystroke, which should not grow with the document.
+	 */
+	void runTextBoxBenchmark()
+	{
+		const int sizes[] = {10000,50000,200000,1000000,4000000};
+		const int keystrokes = 200;
+
+		for(int s = 0; s < 5; ++s)
+		{
+			std::string document;
+			while((int)document.length() < sizes[s])
+			{
+				char line[96];
+				sprintf(line,"%d: a line of log text that wraps around at the "
+					"edge of the box\n",int(document.length()));
+				document += line;
+			}
+
+			HeadlessGui headless(640,480);
+			agui::TextBox textBox;
+			textBox.setSize(400,300);
+			textBox.setMaxLength(sizes[s] * 2);
+			textBox.setWordWrap(true);
+			textBox.setText(document);
+			headless.getGui().add(&textBox);
+			textBox.focus();
+			textBox.positionCaret(0,textBox.getContentHeight() /
+				textBox.getLineHeight() / 2);
+
+			agui::SoftwareInput &input = headless.getInput();
+			for(int i = 0; i < keystrokes; ++i)
+			{
+				double time = input.getTime() + (i + 1) / 60.0;
+				if(i % 4 == 3)
+				{
+					input.scheduleKeyPress(time,agui::KEY_BACKSPACE,8);
+				}
+				else
+				{
+					input.scheduleKeyPress(time,agui::KEY_A,'a');
+				}
+			}
+
+			Timer timer;
+			for(int i = 0; i < keystrokes; ++i)
+			{
+				headless.tick();
+			}
+
+			report("textbox","keystroke",int(document.length()),
+				timer.getMilliseconds() * 1000.0 / keystrokes,"us");
+
+			headless.getGui().remove(&textBox);
+		}
+	}
+}
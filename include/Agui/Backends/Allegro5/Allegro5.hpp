@@ -43,6 +43,7 @@
 
 #include "Agui/Backends/Allegro5/Allegro5Graphics.hpp"
 #include "Agui/Backends/Allegro5/Allegro5ImageLoader.hpp"
+#include "Agui/Backends/Allegro5/Allegro5ImageAtlas.hpp"
 #include "Agui/Backends/Allegro5/Allegro5FontLoader.hpp"
 #include "Agui/Backends/Allegro5/Allegro5Input.hpp"
 #include "Agui/Backends/Allegro5/Allegro5CursorProvider.hpp"
@@ -42,6 +42,7 @@
 #define AGUI_ALLEGRO5_GRAPHICS_MANAGER
 
 #include "Agui/Graphics.hpp"
+#include "Agui/SpriteBatch.hpp"
 #include "Agui/Backends/Allegro5/Allegro5Image.hpp"
 #include "Agui/Backends/Allegro5/Allegro5Font.hpp"
 
@@ -56,13 +57,17 @@
 
 namespace agui {
 	class AGUI_BACKEND_DECLSPEC Allegro5Graphics :
-		public Graphics
+		public Graphics, public SpriteBatch
 	{
+		std::vector<ALLEGRO_VERTEX> vertices;
+		bool spriteClipKnown;
 	protected:
 		ALLEGRO_COLOR getColor(const Color &color);
 		virtual void setClippingRectangle(const Rectangle &rect);
+		virtual void drawSprites(const void* texture,
+			const std::vector<Sprite> &sprites);
 	public:
-		Allegro5Graphics(){}
+		Allegro5Graphics();
 		virtual ~Allegro5Graphics() {}
 		virtual void _beginPaint();
 		virtual void _endPaint();
@@ -91,6 +96,7 @@ namespace agui {
 
 		virtual void setTargetImage(const Image *target);
 		virtual void resetTargetImage();
+		virtual void flush();
 
 	};
 }
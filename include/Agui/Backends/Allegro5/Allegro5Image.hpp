@@ -59,18 +59,44 @@ namespace agui
 		ALLEGRO_BITMAP *bmp;
 		int width;
 		int height;
+		ALLEGRO_BITMAP *page;
+		int pageX;
+		int pageY;
+	protected:
+		virtual bool lockRegion(const Rectangle &region, PixelLockEnum mode,
+			PixelSpan &pixels);
+		virtual void unlockRegion();
 	public:
 		Allegro5Image(void);
 		virtual int getWidth() const;
 		virtual int getHeight() const;
-		virtual Color getPixel(int x, int y) const;
-		virtual void setPixel(int x, int y, const Color& color);
 		virtual bool isAutoFreeing() const;
 		ALLEGRO_BITMAP* getBitmap() const;
 		virtual void free();
 		Allegro5Image(const std::string& fileName,
 			bool convertMask = false);
 		virtual void setBitmap(ALLEGRO_BITMAP* bitmap, bool autoFree = false);
+	/**
+	 * Records that the bitmap is a sub bitmap of an atlas page at x, y.
+	 * Called by Allegro5ImageAtlas after setBitmap.
+     * @since 0.3.0
+     */
+		void _setAtlasPage(ALLEGRO_BITMAP* page, int x, int y);
+	/**
+	 * @return The bitmap the pixels are stored in: the atlas page or the bitmap.
+     * @since 0.3.0
+     */
+		ALLEGRO_BITMAP* getTexture() const;
+	/**
+	 * @return The left of this image in its texture.
+     * @since 0.3.0
+     */
+		int getTextureX() const;
+	/**
+	 * @return The top of this image in its texture.
+     * @since 0.3.0
+     */
+		int getTextureY() const;
 		virtual ~Allegro5Image(void);
 	};
 }
@@ -0,0 +1,74 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_ALLEGRO5_IMAGE_ATLAS_HPP
+#define AGUI_ALLEGRO5_IMAGE_ATLAS_HPP
+#include "Agui/ImageAtlas.hpp"
+#include "Agui/Backends/Allegro5/Allegro5Image.hpp"
+#include <vector>
+
+namespace agui
+{
+	/**
+     * ImageAtlas that copies Allegro5Images into shared Allegro 5 bitmaps.
+	 * Each image is given a sub bitmap of its page, so images drawn
+	 * one after the other can be drawn in one batch.
+	 * The atlas must outlive the images added to it.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_BACKEND_DECLSPEC Allegro5ImageAtlas :
+		public ImageAtlas
+	{
+		std::vector<ALLEGRO_BITMAP*> pages;
+	protected:
+		virtual void createPage(int page, int width, int height);
+		virtual void placeImage(Image* image, int page, const Point &position);
+	public:
+		Allegro5ImageAtlas(int pageWidth = 1024, int pageHeight = 1024, int padding = 1);
+	/**
+	 * @return The page at the parameter index.
+     * @since 0.3.0
+     */
+		ALLEGRO_BITMAP* getPage(int page) const;
+		virtual ~Allegro5ImageAtlas(void);
+	};
+}
+#endif
@@ -0,0 +1,84 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_SOFTWARE_FONT_HPP
+#define AGUI_SOFTWARE_FONT_HPP
+#include "Agui/BaseTypes.hpp"
+
+namespace agui
+{
+	/**
+     * Built in monospaced 8x8 bitmap font for the Software back end.
+	 *
+	 * It has the printable ASCII characters. Other characters are drawn as a box.
+	 * The glyphs are scaled by a whole factor, the requested height divided by 8.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_BACKEND_DECLSPEC SoftwareFont :
+		public Font
+	{
+		std::string path;
+		int scale;
+	public:
+		static const int GLYPH_SIZE = 8;
+		virtual void free();
+		virtual int getLineHeight() const;
+		virtual int getHeight() const;
+		virtual int getTextWidth(const std::string &text) const;
+		virtual const std::string& getPath() const;
+	/**
+	 * @return The factor each glyph pixel is scaled by.
+     * @since 0.3.0
+     */
+		int getScale() const;
+	/**
+	 * @return The 8 rows of the glyph, the lowest bit being the leftmost pixel,
+	 * or NULL if the character has no glyph.
+     * @since 0.3.0
+     */
+		static const unsigned char* getGlyph(unsigned int unichar);
+		SoftwareFont(void);
+		SoftwareFont(const std::string &fileName, int height, FontFlags fontFlags = FONT_DEFAULT_FLAGS, float borderWidth = 0, agui::Color borderColor = agui::Color());
+		virtual void reload(const std::string &fileName, int height, FontFlags fontFlags = FONT_DEFAULT_FLAGS, float borderWidth = 0, agui::Color borderColor = agui::Color());
+		virtual ~SoftwareFont(void);
+	};
+}
+#endif
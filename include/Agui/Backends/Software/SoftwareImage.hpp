@@ -0,0 +1,138 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_SOFTWARE_IMAGE_HPP
+#define AGUI_SOFTWARE_IMAGE_HPP
+#include "Agui/BaseTypes.hpp"
+#include <vector>
+
+namespace agui
+{
+	/**
+     * Image stored as 8 bit RGBA pixels in memory, row by row.
+	 * Locking is free: the span points straight at the pixels.
+	 *
+	 * It can be loaded from and saved to binary PPM (P6) and PAM (P7) files.
+	 *
+	 * When it is packed by a SoftwareImageAtlas its pixels are moved
+	 * into a page and the image becomes a region of that page.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_BACKEND_DECLSPEC SoftwareImage :
+		public Image
+	{
+		std::vector<unsigned char> pixels;
+		int width;
+		int height;
+		SoftwareImage* page;
+		int pageX;
+		int pageY;
+	protected:
+		virtual bool lockRegion(const Rectangle &region, PixelLockEnum mode,
+			PixelSpan &pixels);
+		virtual void unlockRegion();
+	public:
+		SoftwareImage(void);
+		SoftwareImage(int width, int height);
+		SoftwareImage(const std::string& fileName,
+			bool convertMask = false);
+		virtual int getWidth() const;
+		virtual int getHeight() const;
+		virtual bool isAutoFreeing() const;
+		virtual void free();
+	/**
+	 * Resizes the image. Every pixel becomes transparent black.
+	 * Unlocks the image first.
+     * @since 0.3.0
+     */
+		void create(int width, int height);
+	/**
+	 * Sets every pixel to the parameter color.
+     * @since 0.3.0
+     */
+		void clear(const Color &color);
+	/**
+	 * @return The RGBA pixels, 4 bytes per pixel and getPitch bytes per row.
+     * @since 0.3.0
+     */
+		unsigned char* getData();
+		const unsigned char* getData() const;
+	/**
+	 * @return The number of bytes from one row to the next.
+	 * More than 4 * width when the image is in an atlas page.
+     * @since 0.3.0
+     */
+		int getPitch() const;
+	/**
+	 * Copies the pixels into the page at x, y and uses the page from now on.
+	 * Called by SoftwareImageAtlas. Calling create leaves the page.
+     * @since 0.3.0
+     */
+		void _setAtlasPage(SoftwareImage* page, int x, int y);
+	/**
+	 * @return The image the pixels are stored in: the atlas page or this.
+     * @since 0.3.0
+     */
+		const SoftwareImage* getTexture() const;
+	/**
+	 * @return The left of this image in its texture.
+     * @since 0.3.0
+     */
+		int getTextureX() const;
+	/**
+	 * @return The top of this image in its texture.
+     * @since 0.3.0
+     */
+		int getTextureY() const;
+	/**
+	 * @return True if both images have the same size and the same pixels.
+     * @since 0.3.0
+     */
+		bool hasSamePixels(const SoftwareImage &image) const;
+	/**
+	 * Saves the image as a binary PAM file with an alpha channel.
+     * @since 0.3.0
+     */
+		void save(const std::string& fileName) const;
+		virtual ~SoftwareImage(void);
+	};
+}
+#endif
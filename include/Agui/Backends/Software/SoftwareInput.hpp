@@ -0,0 +1,118 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_SOFTWARE_INPUT_HPP
+#define AGUI_SOFTWARE_INPUT_HPP
+#include "Agui/Input.hpp"
+#include <deque>
+#include <utility>
+
+namespace agui
+{
+	/**
+     * Input that replays a script of timed events against a clock that only
+	 * moves when told to, so a run gives the same result every time.
+	 *
+	 * Each call to pollInput, made by Gui::logic, queues the scripted events
+	 * whose time has been reached.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_BACKEND_DECLSPEC SoftwareInput :
+		public Input
+	{
+		double time;
+		std::deque<std::pair<double,MouseInput> > mouseScript;
+		std::deque<std::pair<double,KeyboardInput> > keyboardScript;
+	public:
+		SoftwareInput(void);
+		virtual double getTime() const;
+		virtual void pollInput();
+	/**
+	 * Sets the time returned by getTime, in seconds.
+     * @since 0.3.0
+     */
+		void setTime(double time);
+	/**
+	 * Moves the time returned by getTime forward.
+     * @since 0.3.0
+     */
+		void advanceTime(double seconds);
+	/**
+	 * Schedules the mouse event. Events with the same time keep their order.
+     * @since 0.3.0
+     */
+		void scheduleMouseInput(double time, const MouseInput &input);
+	/**
+	 * Schedules the keyboard event. Events with the same time keep their order.
+     * @since 0.3.0
+     */
+		void scheduleKeyboardInput(double time, const KeyboardInput &input);
+	/**
+	 * Schedules the mouse moving to x, y.
+     * @since 0.3.0
+     */
+		void scheduleMouseMove(double time, int x, int y);
+	/**
+	 * Schedules a press and a release of the mouse button at x, y.
+     * @since 0.3.0
+     */
+		void scheduleMouseClick(double time, int x, int y,
+			MouseButtonEnum button = MOUSE_BUTTON_LEFT);
+	/**
+	 * Schedules a press and a release of the key.
+     * @since 0.3.0
+     */
+		void scheduleKeyPress(double time, KeyEnum key, unsigned int unichar,
+			ExtendedKeyEnum extKey = EXT_KEY_NONE);
+	/**
+	 * @return True if every scheduled event has been queued.
+     * @since 0.3.0
+     */
+		bool isScriptFinished() const;
+	/**
+	 * Removes the scheduled events that have not been queued yet.
+     * @since 0.3.0
+     */
+		void clearScript();
+		virtual ~SoftwareInput(void);
+	};
+}
+#endif
@@ -67,9 +67,10 @@ namespace agui
 	 *
 	 * Should be called in a widget's logic method.
 	 * @param elapsedTime The Amount of time the application has been running.
+	 * @return True if isBlinking changed and the widget needs to be repainted.
      * @since 0.1.0
      */
-		void processBlinkEvent(double elapsedTime);
+		bool processBlinkEvent(double elapsedTime);
 		/**
 	 * When this method returns true, a TextBox's caret is visible.
      * @return A boolean determining if the object should be seen.
@@ -0,0 +1,228 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_DRAW_COMMAND_LIST_HPP
+#define AGUI_DRAW_COMMAND_LIST_HPP
+#include "Agui/Graphics.hpp"
+#include <vector>
+#include <string>
+namespace agui
+{
+	/**
+     * Graphics that records the drawing operations into a list of commands
+	 * and submits them to another Graphics later.
+	 *
+	 * While recording, clipping changes that no drawing operation uses are
+	 * dropped, operations that are outside of the clipping rectangle are
+	 * dropped, and a filled rectangle that touches the previous one along a
+	 * whole edge and has the same color is merged into it.
+	 * The order of the operations is kept.
+	 *
+	 * The list can be submitted any number of times until it is cleared.
+	 * Coordinates are recorded in display coordinates, so the offset of the
+	 * Graphics it is submitted to is set to (0,0).
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC DrawCommandList : public Graphics
+	{
+	public:
+		enum DrawCommandTypeEnum
+		{
+			CLIP,
+			SET_TARGET,
+			RESET_TARGET,
+			IMAGE,
+			SCALED_IMAGE,
+			TEXT,
+			RECTANGLE,
+			FILLED_RECTANGLE,
+			CIRCLE,
+			FILLED_CIRCLE,
+			PIXEL,
+			LINE
+		};
+	private:
+		struct DrawCommand
+		{
+			DrawCommandTypeEnum type;
+			int x;
+			int y;
+			int width;
+			int height;
+			int regionX;
+			int regionY;
+			int regionWidth;
+			int regionHeight;
+			float value;
+			Color color;
+			const Image* image;
+			const Font* font;
+			size_t textStart;
+			AlignmentEnum align;
+		};
+
+		Graphics* graphics;
+		std::vector<DrawCommand> commands;
+		std::string textArena;
+		std::stack<Rectangle> submitStack;
+
+		Rectangle clip;
+		Rectangle recordedClip;
+		bool clipChanged;
+		bool recordedClipKnown;
+
+		int mergedCount;
+		int culledCount;
+		int clipRequestCount;
+		int clipCommandCount;
+		int drawCallCount;
+		int stateChangeCount;
+
+		DrawCommand& addCommand(DrawCommandTypeEnum type);
+		bool beginDraw(int left, int top, int right, int bottom);
+		bool isSameRectangle(const Rectangle &a, const Rectangle &b) const;
+	protected:
+		virtual void setClippingRectangle(const Rectangle &rect);
+	public:
+	/**
+     * Default constructor.
+     * @since 0.3.0
+     */
+		DrawCommandList();
+	/**
+     * Default destructor.
+     * @since 0.3.0
+     */
+		virtual ~DrawCommandList();
+	/**
+     * Sets the Graphics the commands are submitted to.
+	 * Its display size is used as the display size of this.
+     * @since 0.3.0
+     */
+		void setGraphics(Graphics* graphics);
+	/**
+     * @return The Graphics the commands are submitted to.
+     * @since 0.3.0
+     */
+		Graphics* getGraphics() const;
+	/**
+     * Removes every command and resets the recording counters.
+     * @since 0.3.0
+     */
+		void clear();
+	/**
+     * Calls the drawing operations of the Graphics in the order they were recorded.
+     * @since 0.3.0
+     */
+		void submit();
+	/**
+     * @return True if no command is recorded.
+     * @since 0.3.0
+     */
+		bool isEmpty() const;
+	/**
+     * @return The number of recorded commands, including clipping changes.
+     * @since 0.3.0
+     */
+		int getCommandCount() const;
+	/**
+     * @return The number of filled rectangles merged into the previous one since the list was cleared.
+     * @since 0.3.0
+     */
+		int getMergedCount() const;
+	/**
+     * @return The number of operations dropped for being outside
+	 * of the clipping rectangle since the list was cleared.
+     * @since 0.3.0
+     */
+		int getCulledCount() const;
+	/**
+     * @return The number of clipping changes dropped because no operation
+	 * used them or they did not change the clipping rectangle since the list was cleared.
+     * @since 0.3.0
+     */
+		int getSkippedStateChangeCount() const;
+	/**
+     * @return The number of drawing operations the last call to submit made.
+     * @since 0.3.0
+     */
+		int getDrawCallCount() const;
+	/**
+     * @return The number of clipping and target changes the last call to submit made.
+     * @since 0.3.0
+     */
+		int getStateChangeCount() const;
+
+		virtual void _beginPaint();
+		virtual void _endPaint();
+		virtual Dimension getDisplaySize();
+		virtual Rectangle getClippingRectangle();
+		virtual void drawImage(const Image *bmp,
+			const Point &position,const Point &regionStart,
+			const Dimension &regionSize, const float &opacity = 1.0f);
+		virtual void drawImage(const Image *bmp,const Point &position,
+			const float &opacity = 1.0f);
+		virtual void drawScaledImage(const Image *bmp,
+			const Point &position,
+			const Point &regionStart,
+			const Dimension &regionScale,
+			const Dimension &scale,
+			const float &opacity = 1.0f);
+		virtual void drawText(const Point &position,const char* text,
+			const Color &color, const Font *font,
+			AlignmentEnum align = ALIGN_LEFT);
+		virtual void drawRectangle(const Rectangle &rect,
+			const Color &color);
+		virtual void drawFilledRectangle(const Rectangle &rect,
+			const Color &color);
+		virtual void drawCircle(const Point &center,
+			float radius, const Color &color);
+		virtual void drawFilledCircle(const Point &center,
+			float radius,const Color &color);
+		virtual void drawPixel(const Point &point,
+			const Color &color);
+		virtual void drawLine(const Point &start,
+			const Point &end, const Color &color);
+		virtual void setTargetImage(const Image *target);
+		virtual void resetTargetImage();
+	};
+}
+#endif
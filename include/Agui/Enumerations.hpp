@@ -211,5 +211,19 @@ namespace agui
 		FONT_NO_ANTIALIASING = 2,
 		FONT_NO_HINTING = 4
 	};
+
+	enum PixelFormatEnum
+	{
+		PIXEL_FORMAT_RGBA_8888,
+		PIXEL_FORMAT_BGRA_8888,
+		PIXEL_FORMAT_RGB_888
+	};
+
+	enum PixelLockEnum
+	{
+		LOCK_READ_ONLY,
+		LOCK_WRITE_ONLY,
+		LOCK_READ_WRITE
+	};
 }
 #endif
\ No newline at end of file
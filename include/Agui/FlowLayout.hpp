@@ -68,6 +68,11 @@ namespace agui
      * @since 0.1.0
      */
 		virtual void layoutChildren();
+	/**
+	 * Sizes each child to the inner width when rows are resized to the width.
+     * @since 0.3.0
+     */
+		virtual void sizeChildren();
 	public:
 
 	/**
@@ -44,6 +44,8 @@
 #include "Agui/UTF8.hpp"
 #include "Agui/Color.hpp"
 #include "Agui/BaseTypes.hpp"
+#include <vector>
+#include <map>
 namespace agui
 {
 
@@ -66,12 +68,27 @@ namespace agui
 	 * getTextWidth
 	 *
 	 * getPath
+	 *
+	 * The width of each UTF32 character is cached the first time it is measured.
+	 * Back ends should call clearGlyphCache when the underlying font changes.
      * @author Joshua Larouche
      * @since 0.1.0
      */
 	class AGUI_CORE_DECLSPEC Font
 	{
 		static FontLoader* loader;
+		mutable std::vector<int> asciiAdvances;
+		mutable std::map<int,int> glyphAdvances;
+		UTF8 unicodeFunctions;
+
+		int measureGlyph(int unichar) const;
+	protected:
+	/**
+	 * Empties the glyph advance cache. Call this when the underlying font is
+	 * loaded or replaced.
+     * @since 0.3.0
+     */
+		void clearGlyphCache();
 	public:
 	/**
 	 * Should free the underlying font.
@@ -94,6 +111,13 @@ namespace agui
      * @since 0.1.0
      */
 		int getStringIndexFromPosition(const std::string &str, int x) const;
+	/**
+	 * @return The same index as getStringIndexFromPosition, found with a binary search.
+	 * @param prefixWidths The widths from getPrefixWidths.
+	 * @param x The relative x-axis line.
+     * @since 0.3.0
+     */
+		static int getStringIndexFromPosition(const std::vector<int> &prefixWidths, int x);
 	/**
 	 * @return The height specified by the user. This is usually in pixels. It may not be the line height.
      * @since 0.1.0
@@ -104,6 +128,34 @@ namespace agui
      * @since 0.1.0
      */
 		virtual int getTextWidth(const std::string &text) const = 0;
+	/**
+	 * @return The width of the UTF32 character. It is measured with getTextWidth
+	 * the first time and cached afterwards.
+     * @since 0.3.0
+     */
+		int getGlyphAdvance(int unichar) const;
+	/**
+	 * @return The width of the UTF8 string as the sum of its cached glyph advances.
+	 * This matches getTextWidth when Kerning is disabled.
+     * @since 0.3.0
+     */
+		int getTextAdvance(const std::string &text) const;
+	/**
+	 * Measures every prefix of the UTF8 string in one pass.
+	 * @param widths Receives length(text) + 1 values. widths[i] is the
+	 * width of the first i UTF8 characters.
+     * @since 0.3.0
+     */
+		void getPrefixWidths(const std::string &text, std::vector<int> &widths) const;
+	/**
+	 * Measures every prefix of the UTF8 bytes and appends them to widths,
+	 * continuing from its last width. Used to measure text a piece at a time.
+	 * @param widths Receives one value per UTF8 character. A 0 is added
+	 * first if it is empty.
+     * @since 0.3.0
+     */
+		void appendPrefixWidths(const char* text, size_t bytes,
+			std::vector<int> &widths) const;
 	/**
 	 * Sets the font loader for the back end. This will influence the load method.
      * @since 0.1.0
@@ -93,6 +93,8 @@ namespace agui {
 		int T, L, B, R;
 		Rectangle workingRect;
 		Point offset;
+		Rectangle baseClipRect;
+		bool usingBaseClipRect;
 	protected:
 		virtual void setClippingRectangle(const Rectangle &rect) = 0;
 
@@ -120,7 +122,7 @@ namespace agui {
 	/**
 	 * Default constructor.
      */
-		Graphics() {}
+		Graphics() : usingBaseClipRect(false) {}
 	/**
 	 * Default destructor.
      */
@@ -161,6 +163,29 @@ namespace agui {
 	 * Clears the clipping stack. The clipping rectangle is now the display size.
      */
 		void clearClippingStack();
+	/**
+	 * Sets a rectangle, in display coordinates, that every clipping rectangle
+	 * is intersected with, even after the clipping stack is cleared.
+	 *
+	 * Used by the Gui to restrict painting to a damaged area.
+	 * @since 0.3.0
+     */
+		void setBaseClippingRect(const Rectangle &rect);
+	/**
+	 * Removes the base clipping rectangle.
+	 * @since 0.3.0
+     */
+		void clearBaseClippingRect();
+	/**
+	 * @return True if a base clipping rectangle is set.
+	 * @since 0.3.0
+     */
+		bool isUsingBaseClippingRect() const;
+	/**
+	 * @return The base clipping rectangle, in display coordinates.
+	 * @since 0.3.0
+     */
+		const Rectangle& getBaseClippingRect() const;
 	/**
 	 * Draws an image.
 	 * @param bmp The image to draw.
@@ -265,6 +290,14 @@ namespace agui {
 	 * Sets the image that the drawing operations will draw into to the default backbuffer.
      */
 		virtual void resetTargetImage() = 0;
+	/**
+	 * Draws the operations that were deferred to be drawn together.
+	 *
+	 * Called by the Gui when it is done rendering. Must be called before
+	 * the display is flipped when drawing without the Gui.
+	 * @since 0.3.0
+     */
+		virtual void flush();
 
 	};
 }
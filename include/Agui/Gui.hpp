@@ -45,6 +45,7 @@
 #include "Agui/Widget.hpp"
 #include "Agui/EventArgs.hpp"
 #include <stack>
+#include <set>
 #include "Agui/Input.hpp"
 #include "Agui/BaseTypes.hpp"
 #include "Agui/FocusManager.hpp"
@@ -52,6 +53,7 @@
 #include "Agui/MouseListener.hpp"
 #include "Agui/CursorProvider.hpp"
 #include "Agui/Transform.hpp"
+#include "Agui/DrawCommandList.hpp"
 namespace agui
 {
 	class AGUI_CORE_DECLSPEC TopContainer;
@@ -143,13 +145,31 @@ namespace agui
 		int maxToolTipWidth;
 
 		bool wantWidgetLocationChanged;
+		bool widgetUnderMouseDirty;
 		bool enableExistanceCheck;
+		std::set<const Widget*> liveWidgets;
+		std::vector<Widget*> hitCandidates;
 
 		bool useTransform;
 		Transform transform;
 
 		bool delayMouseDown;
 
+		bool dirtyRendering;
+		std::vector<Rectangle> damagedRects;
+		int paintedWidgetCount;
+		int paintedPixelCount;
+		int culledWidgetCount;
+
+		int layoutSuspendCount;
+		bool hasDirtyLayouts;
+		bool flushingLayouts;
+
+		DrawCommandList drawCommands;
+		bool batchingDrawCommands;
+		bool drawCommandsStale;
+		int globalFontID;
+
 	/**
      * Converts the mouse event's position into one that is relative to the parameter widget.
      * @since 0.1.0
@@ -175,6 +195,17 @@ namespace agui
      * @since 0.1.0
      */
 		void resetHoverTime();
+	/**
+     * Invalidates the widget that receives an input event. Private children
+	 * are parts of their parent so the parent is invalidated instead.
+     * @since 0.3.0
+     */
+		void invalidateEventTarget(Widget *target);
+	/**
+     * @return True if the widget is the removed widget or one of its descendants.
+     * @since 0.3.0
+     */
+		bool isRemovedWith(const Widget *widget, const Widget *removed) const;
 
 	/**
      * Sets the key event.
@@ -297,6 +328,11 @@ namespace agui
      * @since 0.1.0
      */
 		void recursiveDoLogic(Widget* baseWidget);
+	/**
+	 * Calls Widget::_flushLayout() for every widget starting at base widget.
+     * @since 0.3.0
+     */
+		void recursiveFlushLayouts(Widget* baseWidget);
 	/**
 	 * Removes the widget from the Gui. It essentially NULLs all pointers of the parameter widget used by the Gui
 	 * to avoid crashes if a widget was under the mouse at the time of its death.
@@ -356,6 +392,12 @@ namespace agui
 		void _modalChanged();
 	/**
      * @return last found widget under the mouse.
+	 *
+	 * Widgets that moved, resized or were added or removed since the last
+	 * logic call are not taken into account until the next one, so the value
+	 * can lag by one tick. Call updateWidgetUnderMouse first to find it again.
+	 * It is not found here because that sends mouse enter and leave events,
+	 * which must not happen from inside of a mouse event handler.
      * @since 0.1.0
      */
 		virtual Widget* getWidgetUnderMouse() const;
@@ -364,11 +406,38 @@ namespace agui
      * @since 0.1.0
      */
 		void _dispatchWidgetDestroyed(Widget* widget);
+	/**
+	 * Called by a widget when the parameter widget and its children
+	 * are added to the Gui's widget tree.
+     * @since 0.3.0
+     */
+		void _registerWidget(Widget* widget);
+	/**
+	 * Called by a widget when the parameter widget and its children
+	 * are removed from the Gui's widget tree.
+     * @since 0.3.0
+     */
+		void _unregisterWidget(Widget* widget);
+	/**
+	 * @return True if the parameter widget is in the Gui's widget tree.
+	 * Does not walk the tree and is safe to call with a deleted widget.
+     * @since 0.3.0
+     */
+		bool _isWidgetRegistered(const Widget* widget) const;
 	/**
 	 * Called by a widget when its location, size, or visibility changes.
+	 * Marks the widget under the mouse to be found again by the next
+	 * call to updateWidgetUnderMouse.
      * @since 0.1.0
      */
 		void _widgetLocationChanged();
+	/**
+	 * Finds the widget under the mouse again and sends the mouse enter and
+	 * leave events if widgets moved since the last update.
+	 * Called by logic before the mouse events are dispatched.
+     * @since 0.3.0
+     */
+		void updateWidgetUnderMouse();
 	/**
 	 * @return True if the Gui is responsible for dequeuing and calling delete on the flagged widgets.
      * @since 0.1.0
@@ -509,6 +578,11 @@ namespace agui
 	 * Will paint every widget in the Gui and their children.
 	 * 
 	 * Call this each time you render.
+	 *
+	 * When dirty rendering is enabled, only the widgets that intersect
+	 * the damaged area are painted and nothing is painted if there is no damage.
+	 *
+	 * Layouts that were suspended are laid out first.
      * @since 0.1.0
      */
 		void render();
@@ -684,6 +758,135 @@ namespace agui
      */
 
 		void toggleWidgetLocationChanged(bool on);
+	/**
+	 * Sets whether or not render only repaints the damaged area.
+	 *
+	 * Widgets add damage when their text, size, location, visibility,
+	 * colors or font change, when they receive input events and when
+	 * a caret blinks. A widget that changes how it looks for any other
+	 * reason must call Widget::invalidate.
+	 *
+	 * The back buffer must keep its content between frames. The damaged area
+	 * is filled with the back color of the top widget before it is repainted.
+     * @since 0.3.0
+     */
+		void setDirtyRendering(bool dirty);
+	/**
+	 * @return True if render only repaints the damaged area.
+     * @since 0.3.0
+     */
+		bool isDirtyRendering() const;
+	/**
+	 * Adds the parameter rectangle, in display coordinates, to the damaged area.
+	 *
+	 * Does nothing unless dirty rendering is enabled.
+     * @since 0.3.0
+     */
+		void invalidateRectangle(const Rectangle &rect);
+	/**
+	 * Damages the whole display so the next render repaints everything.
+     * @since 0.3.0
+     */
+		void invalidate();
+	/**
+	 * @return True if the next render will paint something.
+	 *
+	 * Always true unless dirty rendering is enabled.
+     * @since 0.3.0
+     */
+		bool hasDamage() const;
+	/**
+	 * @return The rectangles that the next render will repaint.
+     * @since 0.3.0
+     */
+		const std::vector<Rectangle>& getDamagedRectangles() const;
+	/**
+	 * @return The number of widgets painted by the last call to render.
+     * @since 0.3.0
+     */
+		int getPaintedWidgetCount() const;
+	/**
+	 * @return The number of pixels repainted by the last call to render.
+     * @since 0.3.0
+     */
+		int getPaintedPixelCount() const;
+	/**
+	 * @return The number of subtrees the last call to render skipped
+	 * because they were outside of the visible area.
+     * @since 0.3.0
+     */
+		int getCulledWidgetCount() const;
+	/**
+	 * Called by a widget each time it is painted.
+     * @since 0.3.0
+     */
+		void _widgetPainted();
+	/**
+	 * Called by a widget when it skips painting a child and its children.
+     * @since 0.3.0
+     */
+		void _widgetCulled();
+	/**
+	 * Sets whether render records the widgets into a DrawCommandList and
+	 * submits it to the Graphics once painting is done.
+	 *
+	 * When render repaints everything and nothing was invalidated since
+	 * the last frame, the recorded commands are submitted again without
+	 * painting the widgets. The same rules as setDirtyRendering apply:
+	 * a widget that changes how it looks must call Widget::invalidate.
+     * @since 0.3.0
+     */
+		void setBatchingDrawCommands(bool batching);
+	/**
+	 * @return True if render records the widgets into a DrawCommandList.
+     * @since 0.3.0
+     */
+		bool isBatchingDrawCommands() const;
+	/**
+	 * @return The commands recorded by the last call to render that painted.
+     * @since 0.3.0
+     */
+		const DrawCommandList& getDrawCommandList() const;
+	/**
+	 * @return The number of drawing operations the last call to render submitted
+	 * or 0 if draw commands are not batched.
+     * @since 0.3.0
+     */
+		int getDrawCallCount() const;
+	/**
+	 * @return The number of clipping and target changes the last call to render
+	 * submitted or 0 if draw commands are not batched.
+     * @since 0.3.0
+     */
+		int getStateChangeCount() const;
+	/**
+	 * Suspends every Layout in the Gui. Until resumeLayouts is called as many times,
+	 * a Layout that needs to be updated is only marked and is laid out once
+	 * when the layouts are flushed. Useful when adding many widgets to layouts.
+     * @since 0.3.0
+     */
+		void suspendLayouts();
+	/**
+	 * Resumes the layouts and flushes them when they are no longer suspended.
+     * @since 0.3.0
+     */
+		void resumeLayouts();
+	/**
+	 * @return True if the layouts in the Gui are suspended.
+     * @since 0.3.0
+     */
+		bool isLayoutSuspended() const;
+	/**
+	 * Lays out each Layout marked while suspended once, parents before children.
+	 * Called by render.
+     * @since 0.3.0
+     */
+		void flushLayouts();
+	/**
+	 * Called by a Layout when it is marked to be laid out by the next flush.
+     * @since 0.3.0
+     */
+		void _layoutDirtied();
 	/**
 	 * Default destructor.
      * @since 0.1.0
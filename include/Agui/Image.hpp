@@ -44,18 +44,24 @@
 #include "Agui/Color.hpp"
 #include "Agui/Point.hpp"
 #include "Agui/Enumerations.hpp"
+#include "Agui/PixelSpan.hpp"
 namespace agui
 {
 
 	class AGUI_CORE_DECLSPEC ImageLoader;
 		/**
      * Abstract class for Images.
+	 *
+	 * Pixels are accessed by locking a region, which gives a PixelSpan
+	 * over it until unlock is called. getPixel and setPixel lock a
+	 * single pixel unless the image is already locked, so lock the image
+	 * once before reading or writing many pixels.
 	 *
 	 * Must implement:
 	 *
-	 * getPixel
+	 * lockRegion
 	 *
-	 * setPixel
+	 * unlockRegion
 	 *
 	 * getWidth
 	 *
@@ -71,7 +77,24 @@ namespace agui
 		Point leftTop;
 		Point rightBottom;
 		static ImageLoader* loader;
-
+		PixelSpan lockedPixels;
+		Rectangle lockedRegion;
+		PixelLockEnum lockMode;
+		bool locked;
+	protected:
+	/**
+	 * Makes the pixels of the region available in memory as RGBA 8888 or any
+	 * other PixelFormatEnum. The region is inside the image and not empty.
+	 * @return False if the pixels could not be locked.
+     * @since 0.3.0
+     */
+		virtual bool lockRegion(const Rectangle &region, PixelLockEnum mode,
+			PixelSpan &pixels) = 0;
+	/**
+	 * Writes back the pixels of the region given to lockRegion if needed.
+     * @since 0.3.0
+     */
+		virtual void unlockRegion() = 0;
 	public:
 	/**
 	 * Sets the margins for a NinePatch image. The rectangle formed by the parameters
@@ -118,15 +141,75 @@ namespace agui
      */
 		virtual int getHeight() const = 0;
 	/**
-	 * @return The Color of the pixel at x , y. (May be very slow).
+	 * @return The Color of the pixel at x , y. Slow unless the image is locked.
      * @since 0.1.0
      */
-		virtual Color getPixel(int x, int y) const = 0;
+		virtual Color getPixel(int x, int y) const;
 	/**
-	 * Sets the pixel at x , y to the parameter color. (May be very slow).
+	 * Sets the pixel at x , y to the parameter color. Slow unless the image is locked.
      * @since 0.1.0
      */
-		virtual void  setPixel(int x, int y, const Color& color) = 0;
+		virtual void  setPixel(int x, int y, const Color& color);
+	/**
+	 * Locks a region of the image so its pixels can be read and written
+	 * through getLockedPixels. Throws if the image is already locked or
+	 * the region is not inside the image.
+	 * @param mode Use LOCK_WRITE_ONLY when every pixel of the region will be
+	 * written, the back end may then skip reading them.
+	 * @return False if the back end could not lock the region.
+     * @since 0.3.0
+     */
+		bool lock(const Rectangle &region, PixelLockEnum mode = LOCK_READ_WRITE);
+	/**
+	 * Locks the whole image.
+	 * @return False if the back end could not lock the image.
+     * @since 0.3.0
+     */
+		bool lock(PixelLockEnum mode = LOCK_READ_WRITE);
+	/**
+	 * Unlocks the image. Does nothing if it is not locked.
+     * @since 0.3.0
+     */
+		void unlock();
+	/**
+	 * @return True if the image is locked.
+     * @since 0.3.0
+     */
+		bool isLocked() const;
+	/**
+	 * @return The pixels of the locked region. The top left pixel of the
+	 * span is the top left pixel of the region. Empty if the image is not locked.
+     * @since 0.3.0
+     */
+		PixelSpan getLockedPixels() const;
+	/**
+	 * @return The locked region.
+     * @since 0.3.0
+     */
+		const Rectangle& getLockedRegion() const;
+	/**
+	 * @return How the image was locked.
+     * @since 0.3.0
+     */
+		PixelLockEnum getLockMode() const;
+	/**
+	 * Sets every pixel to the parameter color. The image must not be locked.
+     * @since 0.3.0
+     */
+		void fill(const Color &color);
+	/**
+	 * Sets every pixel of the area to the parameter color.
+	 * The area is clipped to the image. The image must not be locked.
+     * @since 0.3.0
+     */
+		void fill(const Rectangle &area, const Color &color);
+	/**
+	 * Copies the pixels of the source image so its top left pixel lands on
+	 * position. Works across back ends. Neither image may be locked and
+	 * they must be different images.
+     * @since 0.3.0
+     */
+		void blit(Image* source, const Point &position);
 	/**
 	 * Determines if the Image will destroy the back end specific image when
 	 * the image is changed or deleted.
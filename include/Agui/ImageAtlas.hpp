@@ -0,0 +1,138 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_IMAGE_ATLAS_HPP
+#define AGUI_IMAGE_ATLAS_HPP
+#include "Agui/Platform.hpp"
+#include "Agui/Image.hpp"
+#include <vector>
+namespace agui
+{
+	/**
+     * Abstract class that packs many small images into a few large pages.
+	 *
+	 * Images drawn from the same page can be drawn together by a Graphics
+	 * that batches sprites, so a form whose skins share a page takes
+	 * a few draw calls. The images keep their size and margins and the
+	 * widgets that use them do not change.
+	 *
+	 * Images are packed into rows, tallest first, when build is called.
+	 * The atlas owns the pages and must be destroyed after the images in it.
+	 *
+	 * Must implement:
+	 *
+	 * createPage
+	 *
+	 * placeImage
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC ImageAtlas
+	{
+		int pageWidth;
+		int pageHeight;
+		int padding;
+		int pageCount;
+		int imageCount;
+		std::vector<Image*> pendingImages;
+	protected:
+	/**
+     * Creates an empty page.
+     * @since 0.3.0
+     */
+		virtual void createPage(int page, int width, int height) = 0;
+	/**
+     * Copies the image into the page at the parameter position and makes
+	 * the image draw from the page.
+     * @since 0.3.0
+     */
+		virtual void placeImage(Image* image, int page, const Point &position) = 0;
+	public:
+	/**
+     * Constructs an atlas with pages of the parameter size.
+	 * @param padding The empty pixels kept around each image so filtering
+	 * does not sample its neighbours.
+     * @since 0.3.0
+     */
+		ImageAtlas(int pageWidth = 1024, int pageHeight = 1024, int padding = 1);
+	/**
+     * Default destructor.
+     * @since 0.3.0
+     */
+		virtual ~ImageAtlas();
+	/**
+     * Queues an image to be packed by the next call to build.
+	 * @return False if the image is empty or does not fit in a page.
+     * @since 0.3.0
+     */
+		bool add(Image* image);
+	/**
+     * Packs the queued images into new pages.
+     * @since 0.3.0
+     */
+		void build();
+	/**
+     * @return The number of pages.
+     * @since 0.3.0
+     */
+		int getPageCount() const;
+	/**
+     * @return The number of images packed into the pages.
+     * @since 0.3.0
+     */
+		int getImageCount() const;
+	/**
+     * @return The width of a page.
+     * @since 0.3.0
+     */
+		int getPageWidth() const;
+	/**
+     * @return The height of a page.
+     * @since 0.3.0
+     */
+		int getPageHeight() const;
+	/**
+     * @return The empty pixels kept around each image.
+     * @since 0.3.0
+     */
+		int getPadding() const;
+	};
+}
+#endif
@@ -65,12 +65,20 @@ namespace agui
 		bool updateOnChildResize;
 		bool updateOnChildRelocation;
 		bool updateOnChildAddRemove;
+		int layoutSuspendCount;
+		bool layoutDirty;
 	protected:
 	/**
 	 * Will layout the children according to how the layout should.
 	 * @since 0.1.0
      */
 		virtual void layoutChildren() = 0;
+	/**
+	 * Sizes the children before layoutChildren positions them.
+	 * The default leaves their sizes as they are.
+	 * @since 0.3.0
+     */
+		virtual void sizeChildren();
 	/**
 	 * Empty paint event.
 	 * @since 0.1.0
@@ -96,11 +104,23 @@ namespace agui
 	 * @since 0.1.0
      */
 		virtual void sizeChanged(Widget* source, const Dimension &size);
+	/**
+	 * Does nothing so that editing a child's text does not build it.
+	 * @since 0.3.0
+     */
+		virtual void textEdited(Widget* source, int index,
+			int removedLength, int insertedLength);
 	/**
 	 * Will resize the layout to fit its parent's innerSize.
 	 * @since 0.1.0
      */
 		virtual void parentSizeChanged();
+	/**
+	 * Lays out the children if the layout was marked while the Gui
+	 * suspended layouts. Does nothing while the layout itself is suspended.
+	 * @since 0.3.0
+     */
+		virtual void _flushLayout();
 	public:
 	/**
 	 * Sets whether or not the layout will set its size to its parent's size when its parent's size changes.
@@ -152,8 +172,32 @@ namespace agui
 	/**
 	 * This is what should be called to update the layout. 
 	 * You should never call layoutChildren directly.
+	 *
+	 * While the layout is suspended, it is only marked and is laid out once later.
      */
 		void updateLayout();
+	/**
+	 * Suspends the layout. Until resumeLayout is called as many times, adding,
+	 * removing and resizing children only marks the layout and it is laid out
+	 * once when it is resumed.
+     * @since 0.3.0
+	 */
+		void suspendLayout();
+	/**
+	 * Resumes the layout and lays it out if it was marked while suspended.
+     * @since 0.3.0
+	 */
+		void resumeLayout();
+	/**
+	 * @return True if this layout or the layouts of its Gui are suspended.
+     * @since 0.3.0
+	 */
+		bool isLayoutSuspended() const;
+	/**
+	 * @return True if the layout was marked while suspended and has not been laid out yet.
+     * @since 0.3.0
+	 */
+		bool isLayoutDirty() const;
 		virtual void add(Widget *widget);
 		virtual void remove(Widget *widget);
 		virtual void setSize(const Dimension &size);
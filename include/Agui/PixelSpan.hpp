@@ -0,0 +1,163 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_PIXEL_SPAN_HPP
+#define AGUI_PIXEL_SPAN_HPP
+#include "Agui/Platform.hpp"
+#include "Agui/Color.hpp"
+#include "Agui/Rectangle.hpp"
+#include "Agui/Enumerations.hpp"
+namespace agui
+{
+	/**
+     * Class that describes a block of pixels in memory: where the first row
+	 * starts, how they are stored and how many bytes separate two rows.
+	 *
+	 * It is returned by Image::lock and is only valid until Image::unlock.
+	 * The pitch may be negative when a back end stores rows bottom up.
+	 *
+	 * It does not own the pixels.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC PixelSpan
+	{
+		unsigned char* data;
+		int pitch;
+		PixelFormatEnum format;
+		int width;
+		int height;
+	public:
+	/**
+     * Default constructor. The span is empty.
+     * @since 0.3.0
+     */
+		PixelSpan();
+	/**
+     * Constructs a span over pixels that someone else owns.
+	 * @param data The first pixel of the first row.
+	 * @param pitch The number of bytes from one row to the next.
+	 * @param format How each pixel is stored.
+     * @since 0.3.0
+     */
+		PixelSpan(unsigned char* data, int pitch, PixelFormatEnum format,
+			int width, int height);
+	/**
+     * @return The first pixel of the first row or NULL.
+     * @since 0.3.0
+     */
+		unsigned char* getData() const;
+	/**
+     * @return The first pixel of the parameter row.
+     * @since 0.3.0
+     */
+		unsigned char* getRow(int y) const;
+	/**
+     * @return The number of bytes from one row to the next. May be negative.
+     * @since 0.3.0
+     */
+		int getPitch() const;
+	/**
+     * @return How each pixel is stored.
+     * @since 0.3.0
+     */
+		PixelFormatEnum getFormat() const;
+	/**
+     * @return The width in pixels.
+     * @since 0.3.0
+     */
+		int getWidth() const;
+	/**
+     * @return The height in pixels.
+     * @since 0.3.0
+     */
+		int getHeight() const;
+	/**
+     * @return True if there are no pixels.
+     * @since 0.3.0
+     */
+		bool isEmpty() const;
+	/**
+     * @return The Color of the pixel at x , y. Not bounds checked.
+     * @since 0.3.0
+     */
+		Color getPixel(int x, int y) const;
+	/**
+     * Sets the pixel at x , y to the parameter color. Not bounds checked.
+     * @since 0.3.0
+     */
+		void setPixel(int x, int y, const Color &color);
+	/**
+     * Sets every pixel to the parameter color.
+     * @since 0.3.0
+     */
+		void fill(const Color &color);
+	/**
+     * Sets every pixel of the parameter area to the parameter color.
+	 * The area is clipped to the span.
+     * @since 0.3.0
+     */
+		void fill(const Rectangle &area, const Color &color);
+	/**
+     * Copies the parameter span so its top left pixel lands on position,
+	 * converting the format if needed. Clipped to this span.
+	 * Pixels are replaced, not blended. The spans must not overlap.
+     * @since 0.3.0
+     */
+		void blit(const PixelSpan &source, const Point &position);
+	/**
+     * Copies width by height pixels from one buffer to another,
+	 * converting between the formats. A format without alpha
+	 * reads as opaque. The buffers must not overlap.
+     * @since 0.3.0
+     */
+		static void convert(const unsigned char* source, int sourcePitch,
+			PixelFormatEnum sourceFormat,
+			unsigned char* destination, int destinationPitch,
+			PixelFormatEnum destinationFormat,
+			int width, int height);
+	/**
+     * @return The number of bytes used by one pixel of the parameter format.
+     * @since 0.3.0
+     */
+		static int getBytesPerPixel(PixelFormatEnum format);
+	};
+}
+#endif
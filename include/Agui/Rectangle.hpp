@@ -71,6 +71,21 @@ namespace agui
      */
 		bool isEmpty() const;
 	/**
+     * @return True if the rectangles share at least one pixel.
+     * @since 0.3.0
+     */
+		bool intersects(const Rectangle &rect) const;
+	/**
+     * @return The overlapping area of both rectangles or an empty rectangle.
+     * @since 0.3.0
+     */
+		Rectangle getIntersection(const Rectangle &rect) const;
+	/**
+     * @return The smallest rectangle that contains both rectangles.
+     * @since 0.3.0
+     */
+		Rectangle getUnion(const Rectangle &rect) const;
+	/**
      * @return The X coordinate of the rectangle.
      * @since 0.1.0
      */
@@ -46,6 +46,7 @@
 #include "Agui/UTF8.hpp"
 #include "Agui/Rectangle.hpp"
 #include "Agui/Enumerations.hpp"
+#include "Agui/ShapedText.hpp"
 namespace agui
 {
 	class AGUI_CORE_DECLSPEC Font;
@@ -56,12 +57,19 @@ namespace agui
 	 * Allows rendering an area of text using alignment.
 	 *
 	 * Also allows rendering a single line of text with an ellipsis (...).
+	 *
+	 * The lines made by shapeText are cached with their widths and offsets
+	 * until the font, text, width, alignment or single line mode changes.
      * @author Joshua Larouche
      * @since 0.1.0
      */
 	class AGUI_CORE_DECLSPEC ResizableText {
 		bool singleLine;
 		bool wantEllipsis;
+		ShapedText shapedText;
+
+		int alignLine(int width, int lineWidth, AreaAlignmentEnum align) const;
+		void alignShapedText();
 	protected:
 	/**
      * Splits the text into lines that respect the maxWidth parameter and newline characters.
@@ -131,6 +139,41 @@ namespace agui
      */
 		void makeTextLines(const Font *font, const std::string &text,
 			std::vector<std::string> &textRows, int maxWidth );
+	/**
+     * Makes the lines of text and measures them once.
+	 * Returns the cached ShapedText if the font, text, width and alignment
+	 * did not change. If the lines were not limited by the width,
+	 * growing the width only moves them.
+	 * @param font The font to draw the text.
+	 * @param text The UTF8 encoded string.
+	 * @param maxWidth The width to respect for each line.
+	 * @param align The area alignment of the text.
+     * @since 0.3.0
+     */
+		const ShapedText& shapeText(const Font *font, const std::string &text,
+			int maxWidth, AreaAlignmentEnum align);
+	/**
+     * @return The ShapedText made by the last call to shapeText.
+     * @since 0.3.0
+     */
+		const ShapedText& getShapedText() const;
+	/**
+     * Makes the next call to shapeText make the lines again.
+	 * Call this when a font is reloaded.
+     * @since 0.3.0
+     */
+		void invalidateShapedText();
+	/**
+     * Draws text made by shapeText. Does not measure any text.
+	 * @param g The graphics context. Obtained from paintEvent.graphics().
+	 * @param area Rectangle that determines the maximum height and starting position.
+	 * The width should be the one the text was shaped for.
+	 * @param color The color of the text.
+	 * @param text The shaped text.
+     * @since 0.3.0
+     */
+		void drawShapedText(Graphics *g, const Rectangle &area,
+			const Color &color, const ShapedText &text) const;
 
 
 	};
@@ -61,6 +61,13 @@ namespace agui {
 	public:
 		SelectionListener(void);
 		virtual void selectionChanged(Widget *source, const std::string &item, int index, bool selected) = 0;
+	/**
+	 * Called once for the items from startIndex up to but not including
+	 * endIndex when a ListBox with range selection events selects
+	 * several items at once.
+     * @since 0.3.0
+     */
+		virtual void selectionRangeChanged(Widget *source, int startIndex, int endIndex, bool selected);
 		virtual ~SelectionListener(void);
 	};
 }
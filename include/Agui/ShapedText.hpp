@@ -0,0 +1,147 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_SHAPED_TEXT_HPP
+#define AGUI_SHAPED_TEXT_HPP
+#include "Agui/Platform.hpp"
+#include "Agui/Enumerations.hpp"
+#include <string>
+#include <vector>
+namespace agui
+{
+	class AGUI_CORE_DECLSPEC Font;
+	/**
+     * Class that holds text that was split into lines and measured for a font,
+	 * width and alignment.
+	 *
+	 * Made and cached by ResizableText::shapeText so that drawing it
+	 * with ResizableText::drawShapedText does not measure any text.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC ShapedText
+	{
+		friend class ResizableText;
+
+		const Font* font;
+		std::string text;
+		int maxWidth;
+		AreaAlignmentEnum alignment;
+		bool singleLine;
+		bool wantEllipsis;
+		bool widthLimited;
+		bool valid;
+		int lineHeight;
+		int ellipsisLine;
+		std::vector<std::string> lines;
+		std::vector<int> lineWidths;
+		std::vector<int> lineOffsets;
+	public:
+	/**
+     * Default constructor.
+     * @since 0.3.0
+     */
+		ShapedText();
+	/**
+     * @return True if this was made by ResizableText::shapeText and
+	 * has not been invalidated since.
+     * @since 0.3.0
+     */
+		bool isValid() const;
+	/**
+     * @return The font the text was measured with.
+     * @since 0.3.0
+     */
+		const Font* getFont() const;
+	/**
+     * @return The UTF8 encoded text that was shaped.
+     * @since 0.3.0
+     */
+		const std::string& getText() const;
+	/**
+     * @return The width the lines were made for.
+     * @since 0.3.0
+     */
+		int getMaxWidth() const;
+	/**
+     * @return The alignment the line offsets were made for.
+     * @since 0.3.0
+     */
+		AreaAlignmentEnum getAlignment() const;
+	/**
+     * @return The line height of the font.
+     * @since 0.3.0
+     */
+		int getLineHeight() const;
+	/**
+     * @return The lines of text.
+     * @since 0.3.0
+     */
+		const std::vector<std::string>& getLines() const;
+	/**
+     * @return The number of lines.
+     * @since 0.3.0
+     */
+		int getLineCount() const;
+	/**
+     * @return The advance of the line in pixels.
+     * @since 0.3.0
+     */
+		int getLineWidth(int line) const;
+	/**
+     * @return The horizontal offset of the line from the left of the area
+	 * for the alignment.
+     * @since 0.3.0
+     */
+		int getLineOffset(int line) const;
+	/**
+     * @return The line that ends with an ellipsis (...) or -1 if the text fit.
+     * @since 0.3.0
+     */
+		int getEllipsisLine() const;
+	/**
+     * @return True if the lines were broken or cut because of the width.
+	 * If false, the same lines are valid for any greater width.
+     * @since 0.3.0
+     */
+		bool isWidthLimited() const;
+	};
+}
+#endif
@@ -0,0 +1,96 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_SPATIAL_INDEX_HPP
+#define AGUI_SPATIAL_INDEX_HPP
+#include "Agui/Platform.hpp"
+#include "Agui/Rectangle.hpp"
+#include <vector>
+namespace agui
+{
+	/**
+     * Class that finds which of many rectangles contain a point.
+	 *
+	 * The rectangles are bucketed into a uniform grid that covers all of them,
+	 * so a query only tests the rectangles of one cell.
+	 *
+	 * Used by Widget to hit test its children.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC SpatialIndex
+	{
+		std::vector<Rectangle> rects;
+		std::vector<std::vector<int> > cells;
+		Rectangle bounds;
+		int columns;
+		int rows;
+		int cellWidth;
+		int cellHeight;
+	public:
+	/**
+	 * Default constructor.
+     * @since 0.3.0
+     */
+		SpatialIndex();
+	/**
+	 * Rebuilds the index. The id of each rectangle is its index in the parameter std::vector.
+     * @since 0.3.0
+     */
+		void build(const std::vector<Rectangle> &rects);
+	/**
+	 * Empties the index.
+     * @since 0.3.0
+     */
+		void clear();
+	/**
+	 * Fills the parameter std::vector with the ids of the rectangles that contain
+	 * the parameter point, in ascending order.
+     * @since 0.3.0
+     */
+		void getItemsAt(const Point &p, std::vector<int> &items) const;
+	/**
+	 * Default destructor.
+     * @since 0.3.0
+     */
+		virtual ~SpatialIndex();
+	};
+}
+#endif
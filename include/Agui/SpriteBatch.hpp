@@ -0,0 +1,172 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_SPRITE_BATCH_HPP
+#define AGUI_SPRITE_BATCH_HPP
+#include "Agui/Platform.hpp"
+#include "Agui/Rectangle.hpp"
+#include <vector>
+namespace agui
+{
+	/**
+     * Class that collects image draws that sample the same texture
+	 * so a Graphics can draw them together.
+	 *
+	 * Sprites are clipped on the CPU when they are added, so changing the
+	 * clipping rectangle does not end a batch. A batch ends when a sprite
+	 * uses another texture or when flushSprites is called. A Graphics must
+	 * flush before it draws anything that is not a sprite.
+	 *
+	 * Must implement:
+	 *
+	 * drawSprites
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC SpriteBatch
+	{
+	public:
+	/**
+     * An image region drawn to a destination rectangle.
+     * @since 0.3.0
+     */
+		struct Sprite
+		{
+			/**
+			 * Where the whole region is drawn, in display coordinates.
+			 */
+			Rectangle destination;
+			/**
+			 * The part of the destination inside the clipping rectangle.
+			 */
+			Rectangle visible;
+			/**
+			 * The region of the image that is drawn.
+			 */
+			Rectangle source;
+			/**
+			 * Where the image is in the texture. Sampling must stay inside it.
+			 */
+			Rectangle bounds;
+			float opacity;
+		};
+	private:
+		std::vector<Sprite> sprites;
+		const void* texture;
+		Rectangle clip;
+		bool batching;
+		int batchCount;
+		int spriteCount;
+		int culledSpriteCount;
+	protected:
+	/**
+     * Draws sprites that all sample the parameter texture, in order.
+     * @since 0.3.0
+     */
+		virtual void drawSprites(const void* texture,
+			const std::vector<Sprite> &sprites) = 0;
+	/**
+     * Sets the clipping rectangle, in display coordinates, of the sprites added after this.
+     * @since 0.3.0
+     */
+		void setSpriteClippingRectangle(const Rectangle &rect);
+	/**
+     * Adds a sprite. Draws the current batch first if it uses another texture.
+	 * @param texture Identifies what the sprite is sampled from.
+	 * @param bounds Where the image is in the texture.
+	 * @param destination Where the region is drawn, in display coordinates.
+	 * @param source The region of the image, relative to the image.
+	 * @param opacity How opaque the sprite will be drawn.
+     * @since 0.3.0
+     */
+		void addSprite(const void* texture, const Rectangle &bounds,
+			const Rectangle &destination, const Rectangle &source,
+			float opacity);
+	public:
+	/**
+     * Default constructor.
+     * @since 0.3.0
+     */
+		SpriteBatch();
+	/**
+     * Default destructor.
+     * @since 0.3.0
+     */
+		virtual ~SpriteBatch();
+	/**
+     * Draws the sprites that were added since the last flush.
+     * @since 0.3.0
+     */
+		void flushSprites();
+	/**
+     * Sets whether sprites are collected. If false, each sprite is drawn
+	 * as soon as it is added.
+     * @since 0.3.0
+     */
+		void setSpriteBatching(bool batching);
+	/**
+     * @return True if sprites are collected until the texture changes or they are flushed.
+     * @since 0.3.0
+     */
+		bool isSpriteBatching() const;
+	/**
+     * @return The number of times drawSprites was called since the counters were reset.
+     * @since 0.3.0
+     */
+		int getSpriteBatchCount() const;
+	/**
+     * @return The number of sprites drawn since the counters were reset.
+     * @since 0.3.0
+     */
+		int getSpriteCount() const;
+	/**
+     * @return The number of sprites dropped for being outside of the
+	 * clipping rectangle since the counters were reset.
+     * @since 0.3.0
+     */
+		int getCulledSpriteCount() const;
+	/**
+     * Sets the counters to 0.
+     * @since 0.3.0
+     */
+		void resetSpriteBatchCounters();
+	};
+}
+#endif
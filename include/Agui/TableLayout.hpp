@@ -60,12 +60,22 @@ namespace agui
 		int columns;
 		int horizontalSpacing;
 		int verticalSpacing;
+		int measuredColumns;
+		std::vector<int> columnWidths;
+		std::vector<int> rowHeights;
 	protected:
 	/**
-     * Lays out the children in a grid.
+     * Positions the children in the measured rows and columns
+	 * and sizes the table to the preferred size.
      * @since 0.1.0
      */
 		virtual void layoutChildren();
+	/**
+     * Measures the width of each column and the height of each row.
+	 * @return The size of the table plus the margins.
+     * @since 0.3.0
+     */
+		virtual Dimension computePreferredSize();
 	public:
 	/**
      * Sets the number of rows expected to have.
@@ -0,0 +1,186 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_TEXT_BUFFER_HPP
+#define AGUI_TEXT_BUFFER_HPP
+#include "Agui/Platform.hpp"
+#include <string>
+#include <vector>
+namespace agui
+{
+	class AGUI_CORE_DECLSPEC Font;
+	/**
+     * Class that stores UTF8 text as a piece table.
+	 *
+	 * The pieces are kept in a balanced tree that indexes UTF8 characters,
+	 * bytes and newlines so that inserting, erasing and finding an index
+	 * take O(log n). The text is only copied into a single string when
+	 * getString is called.
+	 *
+	 * Used by TextBox and TextField.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC TextBuffer
+	{
+		struct Piece
+		{
+			bool added;
+			size_t start;
+			size_t bytes;
+			int chars;
+			int newlines;
+			unsigned int priority;
+			size_t totalBytes;
+			int totalChars;
+			int totalNewlines;
+			Piece* left;
+			Piece* right;
+		};
+
+		mutable std::string original;
+		mutable std::string added;
+		mutable Piece* root;
+		mutable bool flat;
+		mutable unsigned int seed;
+
+		const char* getPieceText(const Piece* piece) const;
+		Piece* createPiece(bool added, size_t start, size_t bytes) const;
+		Piece* createPieces(bool added, size_t start, size_t bytes) const;
+		void countPiece(Piece* piece) const;
+		void update(Piece* piece) const;
+		Piece* merge(Piece* left, Piece* right) const;
+		void split(Piece* piece, int index, Piece* &left, Piece* &right) const;
+		size_t getPieceByteOffset(const Piece* piece, int index) const;
+		bool extendLast(Piece* piece, size_t start, size_t bytes);
+		void destroy(Piece* piece) const;
+		void appendPiece(const Piece* piece, int &skip,
+			int &length, std::string &out) const;
+		bool pieceContains(const Piece* piece, char c) const;
+		void appendPiecePrefixWidths(const Piece* piece, const Font* font,
+			std::vector<int> &widths) const;
+		void flatten() const;
+
+		TextBuffer(const TextBuffer&);
+		TextBuffer& operator=(const TextBuffer&);
+	public:
+	/**
+     * Default constructor.
+     * @since 0.3.0
+     */
+		TextBuffer();
+	/**
+     * Default destructor.
+     * @since 0.3.0
+     */
+		virtual ~TextBuffer();
+	/**
+     * Replaces all the text.
+     * @since 0.3.0
+     */
+		void setText(const std::string &text);
+	/**
+     * Inserts the UTF8 string before the UTF8 character at index.
+     * @since 0.3.0
+     */
+		void insert(int index, const std::string &text);
+	/**
+     * Erases length UTF8 characters starting at index.
+     * @since 0.3.0
+     */
+		void erase(int index, int length);
+	/**
+     * @return The number of UTF8 characters.
+     * @since 0.3.0
+     */
+		int getLength() const;
+	/**
+     * @return The number of bytes.
+     * @since 0.3.0
+     */
+		size_t getByteLength() const;
+	/**
+     * @return The number of lines. This is the number of newlines + 1.
+     * @since 0.3.0
+     */
+		int getLineCount() const;
+	/**
+     * @return The UTF8 index of the first character of the line.
+     * @since 0.3.0
+     */
+		int getLineStart(int line) const;
+	/**
+     * @return The byte offset of the UTF8 character at index.
+     * @since 0.3.0
+     */
+		size_t getByteOffset(int index) const;
+	/**
+     * @return The UTF8 sub string from index to index + length UTF8 characters.
+     * @since 0.3.0
+     */
+		std::string getSubString(int index, int length) const;
+	/**
+     * @return True if the UTF8 character at index is a newline.
+     * @since 0.3.0
+     */
+		bool isNewline(int index) const;
+	/**
+     * @return True if the byte c is in the text. Each piece is searched
+	 * as it is, so the text is not merged. In UTF8 an ASCII character
+	 * is never part of another character.
+     * @since 0.3.0
+     */
+		bool contains(char c) const;
+	/**
+     * Measures every prefix of the text a piece at a time, so the text
+	 * is not merged.
+	 * @param widths Receives getLength() + 1 values, like Font::getPrefixWidths.
+     * @since 0.3.0
+     */
+		void getPrefixWidths(const Font* font, std::vector<int> &widths) const;
+	/**
+     * @return The whole text. The pieces are merged into one string,
+	 * which stays valid until the next edit.
+     * @since 0.3.0
+     */
+		const std::string& getString() const;
+	};
+}
+#endif
@@ -290,6 +290,27 @@ namespace agui
 			/* Otherwise is illegal. */
 			return 0;
 		}
+	/**
+	 * @return The UTF32 character encoded by the first 'length' bytes of inputChars.
+	 *
+	 * The length is usually the value returned by bringToNextUnichar.
+     * @since 0.3.0
+     */
+		inline int decodeUtf8(const char inputChars[], size_t length) const
+		{
+			unsigned int uc = (unsigned char)inputChars[0];
+
+			if (length <= 1 || length > 4) {
+				return int(uc);
+			}
+
+			uc &= 0x7F >> length;
+			for(size_t i = 1; i < length; ++i) {
+				uc = (uc << 6) | ((unsigned char)inputChars[i] & 0x3F);
+			}
+
+			return int(uc);
+		}
 
 	};
 }
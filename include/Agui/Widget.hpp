@@ -58,6 +58,7 @@
 namespace agui {
 	typedef std::vector<Widget*> WidgetArray;
 	class AGUI_CORE_DECLSPEC Gui;
+	class AGUI_CORE_DECLSPEC SpatialIndex;
 
 	 /**
      * Abstract base class for all widgets in Agui.
@@ -165,13 +166,54 @@ namespace agui {
      */
 
 		void _parentSizeChangedEvent();
+	/**
+     * Paints root and its children. Subtrees whose absolute rectangle does
+	 * not intersect the visible rectangle, in display coordinates, are skipped.
+     * @since 0.3.0
+     */
+		void recursivePaintChildren(Widget *root, bool enabled,
+			Graphics *graphicsContext, const Rectangle &visible);
 
 		Widget *parentWidget;
 
+		SpatialIndex *childIndex;
+		bool childIndexDirty;
+
+		mutable Point absPosition;
+		mutable bool absPositionDirty;
+	/**
+     * @return The cached absolute position, updated first if it is dirty.
+     * @since 0.3.0
+     */
+		const Point& getCachedAbsolutePosition() const;
+	/**
+     * Marks the cached absolute position of this widget and its children as dirty.
+	 *
+	 * A dirty widget only has dirty children, so this stops at a dirty widget.
+     * @since 0.3.0
+     */
+		void invalidateAbsolutePosition();
+
+		Dimension preferredSize;
+		bool preferredSizeValid;
+		bool preferredSizeFromSize;
+		bool privateChild;
+
 	protected: 
 		FocusManager* _focusManager;
 		Gui* _container;
 
+	/**
+     * Measures the size the widget needs for its contents. Called by
+	 * getPreferredSize when the cached preferred size is not valid.
+	 *
+	 * The default is the current size, which is not cached across resizes.
+	 * Widgets that size to their contents should override this and call
+	 * invalidatePreferredSize when anything the measure uses changes.
+     * @since 0.3.0
+     */
+		virtual Dimension computePreferredSize();
+
 	/**
      * Paints the interior of the widget after the background has been painted.
 	 * painting is relative to the top left margins.
@@ -267,6 +309,25 @@ namespace agui {
 	*/
 		virtual void dispatchActionEvent(const ActionEvent &evt);
 	/**
+	* Tells all of the widget listeners that the text changed.
+	*
+	* Widgets that store their text elsewhere call this instead of setText.
+	* The listeners receive getText().
+	* @since 0.3.0
+	*/
+		void dispatchTextChangedEvent();
+	/**
+	* Tells all of the widget listeners which part of the text was edited.
+	*
+	* Widgets that edit their text in place call this so that listeners
+	* which do not read the text do not make the widget build it.
+	* @param index The UTF8 index of the first edited character.
+	* @param removedLength The number of UTF8 characters removed at index.
+	* @param insertedLength The number of UTF8 characters inserted at index.
+	* @since 0.3.0
+	*/
+		void dispatchTextEditedEvent(int index, int removedLength, int insertedLength);
+	/**
 	*Instance of the UTF8 class, contains useful UTF8 functions.
 	* @since 0.1.0
 	*/
@@ -338,6 +399,30 @@ namespace agui {
 		void _recursivePaintChildren(Widget *root, bool enabled,
 			Graphics *graphicsContext);
 	/**
+	* Called by the Gui on every widget, parents before children, when it
+	* flushes the layouts that were suspended. Does nothing unless overridden.
+	* @since 0.3.0
+	*/
+		virtual void _flushLayout();
+	/**
+	* @return True if this widget is a private child of its parent.
+	* Does not search the parent's private children.
+	* @since 0.3.0
+	*/
+		bool _isPrivateChild() const;
+	/**
+	* Gives the global font to this widget and its children if they use
+	* it and the global font changed since they were given it. Called by
+	* the Gui before painting so painting never changes a font.
+	* @since 0.3.0
+	*/
+		void _applyGlobalFont();
+	/**
+	* @return A number that changes every time the global font is set.
+	* @since 0.3.0
+	*/
+		static int _getGlobalFontID();
+	/**
 	* If it is flagged, the Gui it belongs to will delete it in the next logic loop
 	* unless it was not part of a Gui when it was flagged or a flag in the Gui
 	* has been set indicating that the Gui's stack of flagged widgets must be manually popped.
@@ -386,7 +471,7 @@ namespace agui {
 	* @param r The right margin.
 	* @since 0.1.0
 	*/
-		void setMargins(int t, int l, int b, int r);
+		virtual void setMargins(int t, int l, int b, int r);
 
 
 	/**
@@ -501,6 +586,14 @@ namespace agui {
 	* @since 0.1.0
 	*/
 		virtual void clip(const PaintEvent &paintEvent);
+	/**
+	* Tells the Gui that this widget needs to be repainted.
+	*
+	* Only needed when dirty rendering is enabled and the widget
+	* changes how it looks for a reason the Gui does not know about.
+	* @since 0.3.0
+	*/
+		void invalidate();
 
 	/**
 	* Adds the parameter widget to this widget's children.
@@ -536,6 +629,28 @@ namespace agui {
 	*/
 		int		getChildCount()const;
 	/**
+	* Sets whether or not the public children are kept in a SpatialIndex
+	* so that finding the widget under the mouse does not test every child.
+	* Useful for widgets with many children.
+	*
+	* Assumes that intersectionWithPoint of each child is only true
+	* inside of the child's size.
+	* @since 0.3.0
+	*/
+		void	setChildIndexing(bool indexing);
+	/**
+	* @return True if the public children are kept in a SpatialIndex.
+	* @since 0.3.0
+	*/
+		bool	isChildIndexing() const;
+	/**
+	* Fills the parameter std::vector with the public children whose
+	* rectangles contain the parameter point, in child order. The point
+	* is relative to the inner area of this widget. Used by the Gui.
+	* @since 0.3.0
+	*/
+		void	_getChildrenAt(const Point &p, WidgetArray &candidates);
+	/**
 	* @return The margin of the side specified by the parameter.
 	* @param side The side to get the margin of.
 	* @since 0.1.0
@@ -1198,6 +1313,17 @@ namespace agui {
 	* @since 0.2.0
 	*/
     virtual void resizeToContents();
+	/**
+	* @return The size the Widget needs for its contents. It is measured once
+	* and cached until the text, font, margins, minimum or maximum size change.
+	* @since 0.3.0
+	*/
+    const Dimension& getPreferredSize();
+	/**
+	* Marks the preferred size of the Widget and of its parents to be measured again.
+	* @since 0.3.0
+	*/
+    void invalidatePreferredSize();
 	    /** Implementation differs per widget. Will resize the Widget to fit its contents recursively.
 	* ex: Button will resize to fit its text.
 	* @since 0.2.0
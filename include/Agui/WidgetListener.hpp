@@ -68,6 +68,15 @@ namespace agui {
 		virtual void fontChanged(Widget*, const Font *) {}
 
 		virtual void textChanged(Widget*, const std::string &) {}
+	/**
+	 * Called when a TextBox or TextField edits part of its text.
+	 * The default calls textChanged with the whole text, which makes the
+	 * widget build it. Listeners that do not read the text should
+	 * override this to do nothing.
+     * @since 0.3.0
+     */
+		virtual void textEdited(Widget* source, int index,
+			int removedLength, int insertedLength);
 
 		virtual void enabledChanged(Widget*, bool) {}
 
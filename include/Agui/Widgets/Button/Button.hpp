@@ -64,7 +64,6 @@ namespace agui {
 			CLICKED
 		};
 	private:
-		std::vector<std::string> wrappedText;
 		std::vector<ButtonListener*> buttonListeners;
 		AreaAlignmentEnum textAlignment;
 		Button::ButtonStateEnum buttonState;
@@ -77,7 +76,7 @@ namespace agui {
 		Button::ButtonStateEnum mouseLeaveState;
 
 	protected:
-		ResizableText resizableText;
+		mutable ResizableText resizableText;
 	 /**
 	 * Internally changes the toggled value.
      * @since 0.1.0
@@ -105,6 +104,11 @@ namespace agui {
      * @since 0.1.0
      */
 		virtual const std::vector<std::string>& getAreaText() const;
+	/**
+	 * @return The size of the text plus the margins.
+     * @since 0.3.0
+     */
+		virtual Dimension computePreferredSize();
 	public:
 	/**
 	 * Default constructor.
@@ -53,7 +53,6 @@ namespace agui {
 	class AGUI_CORE_DECLSPEC Label : public Widget {
 		AreaAlignmentEnum alignment;
 		std::vector<std::string> words;
-		std::vector<std::string> lines;
 		std::vector<LabelListener*> labelListeners;
 		bool isLabelAutosizing;
 	/**
@@ -66,7 +65,8 @@ namespace agui {
 		virtual void paintComponent(const PaintEvent &paintEvent);
 		virtual void paintBackground(const PaintEvent &paintEvent);
 	/**
-	 * Updates the text of the label.
+	 * Shapes the text of the label again. Called by every setter that
+	 * changes the shaped text, so painting only reads it.
      * @since 0.1.0
      */
 		void updateLabel();
@@ -75,6 +75,11 @@ namespace agui {
      * @since 0.1.0
      */
 		virtual void drawText(const PaintEvent &paintEvent);
+	/**
+	 * @return The width of the text and the height of the lines it wraps to at that width.
+     * @since 0.3.0
+     */
+		virtual Dimension computePreferredSize();
 	public:
 			/**
      * Sets whether this should only be rendered on a single line
@@ -99,6 +104,7 @@ namespace agui {
 		virtual void setSize(int width, int height);
 		virtual void setText(const std::string &text);
 		virtual void setFont(const Font *font);
+		virtual void setMargins(int t, int l, int b, int r);
 	/**
      * Adds the parameter LabelListener.
      * @since 0.1.0
@@ -151,7 +157,7 @@ namespace agui {
 	 * @return The array of text lines used to render the text.
      * @since 0.2.0
      */
-		std::vector<std::string>& getTextLines();
+		const std::vector<std::string>& getTextLines() const;
 
     /**
     * Resizes the Label to fit the caption text, adjusts only height.
@@ -46,6 +46,8 @@
 #include "Agui/MouseListener.hpp"
 #include "Agui/SelectionListener.hpp"
 #include "Agui/Widgets/ListBox/ListBoxListener.hpp"
+#include "Agui/Widgets/ListBox/ListBoxModel.hpp"
+#include <map>
 namespace agui {
 		/**
 	 * Class that represents ListBox.
@@ -103,7 +105,7 @@ namespace agui {
 
 		ScrollPolicy hScrollPolicy;
 		ScrollPolicy vScrollPolicy;
-		ListItem items;
+		mutable ListItem items;
 
 		std::vector<ListBoxListener*> listboxListeners;
 		std::vector<SelectionListener*> selectionListeners;
@@ -117,6 +119,21 @@ namespace agui {
 		bool isMaintainingScrollInset;
 
 		agui::Color newItemColor;
+
+		std::map<int,int> itemWidths;
+		int updateDepth;
+
+		ListBoxModel *model;
+		mutable ListBoxItem modelItem;
+
+		mutable std::map<int,int> selectedRanges;
+		mutable bool selectionDirty;
+		mutable bool selectionFlagsStale;
+		bool rangeSelectionEvents;
+
+		void updateSelectionRanges() const;
+		void updateSelectionFlags() const;
+		void shiftSelectionRanges(int index, int count);
 		
 
 	protected:
@@ -125,6 +142,41 @@ namespace agui {
      * @since 0.2.0
      */
 		void _setWidestItem(int widest);
+	/**
+	 * Counts the width of a new item toward the widest item.
+     * @since 0.3.0
+     */
+		void addItemWidth(const std::string &text);
+	/**
+	 * Removes the width of a removed item from the widest item.
+     * @since 0.3.0
+     */
+		void removeItemWidth(const std::string &text);
+	/**
+	 * Sorts the items, updates the scroll bars and the hover index
+	 * after items were added or removed. Does nothing during an update.
+     * @since 0.3.0
+     */
+		void itemsChanged();
+	/**
+	 * Selects or deselects the item at the parameter index without
+	 * dispatching a selection event.
+     * @since 0.3.0
+     */
+		void setIndexSelected(int index, bool selected);
+	/**
+	 * Selects or deselects the items from startIndex up to but not including
+	 * endIndex without dispatching a selection event.
+     * @since 0.3.0
+     */
+		void setRangeSelected(int startIndex, int endIndex, bool selected);
+	/**
+	 * Used to dispatch one selection event for the items from startIndex
+	 * up to but not including endIndex. Dispatches one event per item
+	 * unless range selection events are enabled.
+     * @since 0.3.0
+     */
+		virtual void dispatchSelectionRangeEvent(int startIndex, int endIndex, bool selected);
 	 /**
 	 * Used to dispatch a selection event to the selection listeners.
      * @since 0.1.0
@@ -648,6 +700,69 @@ namespace agui {
      * @since 0.1.0
      */
 		ListItem ::const_reverse_iterator getItemsREnd() const;
+	/**
+	 * Starts a batch of changes. Until the matching endUpdate, adding and
+	 * removing items will not sort them or update the scroll bars.
+	 * Calls may be nested.
+     * @since 0.3.0
+     */
+		virtual void beginUpdate();
+	/**
+	 * Ends a batch of changes. When the outermost batch ends, the items are
+	 * sorted once and the scroll bars are updated.
+     * @since 0.3.0
+     */
+		virtual void endUpdate();
+	/**
+	 * @return True if inside of a beginUpdate and endUpdate pair.
+     * @since 0.3.0
+     */
+		bool isUpdating() const;
+	/**
+	 * Sets the model that provides the items or NULL to use the ListBox's own items.
+	 *
+	 * While a model is set, only the visible items are requested from it.
+	 * Adding, removing and sorting items does nothing, and the item
+	 * iterators do not include the model's items. The selection is cleared.
+	 * The model is not owned by the ListBox.
+     * @since 0.3.0
+     */
+		virtual void setModel(ListBoxModel *model);
+	/**
+	 * @return The model that provides the items or NULL.
+     * @since 0.3.0
+     */
+		ListBoxModel* getModel() const;
+	/**
+	 * Must be called after the model's items change. Updates the selection,
+	 * the widest item and the scroll bars.
+     * @since 0.3.0
+     */
+		virtual void modelChanged();
+	/**
+	 * @return True if the item at the parameter index is selected.
+     * @since 0.3.0
+     */
+		bool isIndexSelected(int index) const;
+	/**
+	 * @return The selected items as pairs of a start index and an end index.
+	 * Each end index is one past the last selected item of that range.
+     * @since 0.3.0
+     */
+		std::vector<std::pair<int,int> > getSelectedRanges() const;
+	/**
+	 * Sets whether or not selecting several items at once sends a single
+	 * selectionRangeChanged to the SelectionListeners instead of one
+	 * selectionChanged per item.
+     * @since 0.3.0
+     */
+		void setRangeSelectionEvents(bool rangeEvents);
+	/**
+	 * @return True if selecting several items at once sends a single
+	 * selectionRangeChanged to the SelectionListeners.
+     * @since 0.3.0
+     */
+		bool isRangeSelectionEvents() const;
 		
 
 	virtual void setFontColor(const Color &color);
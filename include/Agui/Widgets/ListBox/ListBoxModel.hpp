@@ -0,0 +1,94 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_LISTBOX_MODEL_HPP
+#define AGUI_LISTBOX_MODEL_HPP
+#include "Agui/Platform.hpp"
+#include "Agui/Color.hpp"
+#include <string>
+namespace agui {
+	class AGUI_CORE_DECLSPEC Font;
+		/**
+     * Abstract class for ListBox data models.
+	 *
+	 * A ListBox that uses a model does not copy the items. It asks the model
+	 * for the items it needs, which are usually only the visible ones.
+	 * The ListBox does not own the model.
+	 *
+	 * Any derived ListBox Models should inherit from this class.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC ListBoxModel
+	{
+	public:
+		ListBoxModel(void);
+		virtual ~ListBoxModel(void);
+	/**
+	 * @return The number of items.
+     * @since 0.3.0
+     */
+		virtual int getItemCount() const = 0;
+	/**
+	 * @return The text of the item at the parameter index.
+     * @since 0.3.0
+     */
+		virtual std::string getItemText(int index) const = 0;
+	/**
+	 * @return The text color of the item at the parameter index.
+	 * Returns the ListBox's new item color by default.
+     * @since 0.3.0
+     */
+		virtual Color getItemColor(int index, const Color &defaultColor) const;
+	/**
+	 * @return The ToolTip text of the item at the parameter index or "" for none.
+     * @since 0.3.0
+     */
+		virtual std::string getItemToolTip(int index) const;
+	/**
+	 * @return The width of the widest item in the parameter font. Used for
+	 * the horizontal scroll range. Returns 0 by default so that
+	 * a large model is never measured.
+     * @since 0.3.0
+     */
+		virtual int getWidestItem(const Font *font) const;
+	};
+}
+#endif
@@ -82,6 +82,7 @@ namespace agui {
 		virtual const std::string& getShortcutText() const;
 		virtual void setSubMenu(PopUpMenu* menu);
 		virtual PopUpMenu* getSubMenu() const;
+		virtual void setText(const std::string &text);
 		virtual bool isSeparator() const;
 		virtual bool isSubMenu() const;
 		virtual void setParentMenu(PopUpMenu* menu);
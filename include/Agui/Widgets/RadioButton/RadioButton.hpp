@@ -150,6 +150,11 @@ namespace agui {
 
 		virtual void paintComponent(const PaintEvent &paintEvent);
 		virtual void paintBackground(const PaintEvent &paintEvent);
+	/**
+	 * @return The size of the RadioButton and its caption text plus the margins.
+     * @since 0.3.0
+     */
+		virtual Dimension computePreferredSize();
 	public:
 			/**
 	 * @return The side padding. This pads symmetrically from left to right or 
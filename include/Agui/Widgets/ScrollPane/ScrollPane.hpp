@@ -48,6 +48,8 @@
 #include "Agui/WidgetListener.hpp"
 #include "Agui/MouseListener.hpp"
 #include "Agui/KeyboardListener.hpp"
+#include <map>
+#include <set>
 
 namespace agui {
 	/**
@@ -89,6 +91,27 @@ namespace agui {
 		bool isMaintainingVScroll;
 		bool isMaintainingInset;
 		bool isMaintainingContent;
+
+		std::map<Widget*,Rectangle> contentExtents;
+		std::multiset<int> contentRights;
+		std::multiset<int> contentBottoms;
+		int updateDepth;
+	/**
+     * Records the rectangle of a content child so the content size is known
+	 * without scanning every child.
+     * @since 0.3.0
+     */
+		void addContentExtent(Widget* widget);
+	/**
+     * Forgets the recorded rectangle of a content child.
+     * @since 0.3.0
+     */
+		void removeContentExtent(Widget* widget);
+	/**
+     * Records the new rectangle of a content child that moved or resized.
+     * @since 0.3.0
+     */
+		void updateContentExtent(Widget* widget);
 	protected:
 	/**
      * Enables or disables the ScrollBars based on the ScrollPolicy.
@@ -111,6 +134,12 @@ namespace agui {
      */
 		virtual void updateScrollBars();
 	/**
+     * Resizes the content widget to the content width and height if they changed.
+	 * The content widget's size change then updates the scroll bars.
+     * @since 0.3.0
+     */
+		void updateContentSize();
+	/**
      * Uses arrow keys to scroll when another widget has focus. 
 	 * You can call this in the ScrollPane's keyDown and keyRepeat events if you need it when it
 	 * is focused.
@@ -136,6 +165,8 @@ namespace agui {
 		virtual void valueChanged(VScrollBar* source,int val);
 
 		virtual void textChanged(Widget* source, const std::string &text);
+		virtual void textEdited(Widget* source, int index,
+			int removedLength, int insertedLength);
 	/**
 	 * This will resize the content widget to the content width and height and update the scrollbars.
 	 * Override this if that is not what you want.
@@ -360,6 +391,24 @@ namespace agui {
      * @since 0.1.0
      */
 		virtual void resizeToContents();
+	/**
+	 * Starts a batch of changes. Until the matching endUpdate, adding, removing,
+	 * moving and resizing content will not resize the content widget or update
+	 * the scroll bars. Calls may be nested.
+     * @since 0.3.0
+     */
+		virtual void beginUpdate();
+	/**
+	 * Ends a batch of changes. When the outermost batch ends, the content
+	 * widget is resized once and the scroll bars are updated.
+     * @since 0.3.0
+     */
+		virtual void endUpdate();
+	/**
+	 * @return True if inside of a beginUpdate and endUpdate pair.
+     * @since 0.3.0
+     */
+		bool isUpdating() const;
 	/**
 	 * Construct with optional HorizontalScrollBar ,
 	 * VerticalScrollBar , ScrollInset Widget , and content Widget.
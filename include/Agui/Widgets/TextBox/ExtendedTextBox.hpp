@@ -42,6 +42,7 @@
 #define AGUI_EXTENDED_TEXTBOX_HPP
 
 #include "Agui/Widgets/TextBox/TextBox.hpp"
+#include "Agui/Widgets/TextBox/TextStyleRuns.hpp"
 #include <map>
 namespace agui {
 	/**
@@ -69,7 +70,7 @@ namespace agui {
 		Point colorIndexStart;
 		int lastVisibleIndex;
 		bool isEditingText;
-		std::vector<std::pair<Color,Image*> > textColors;
+		TextStyleRuns textStyles;
 		std::map<std::string,Image*> icons;
 		std::map<Image*,std::string> iconClipboardText;
 		Color selectionFontColor;
@@ -117,6 +118,11 @@ namespace agui {
      * @since 0.1.0
      */
 		virtual int addToNextCharacter(int unichar);
+	/**
+	 * Removes the oldest lines and their colors when there are more than the max line count.
+     * @since 0.3.0
+     */
+		virtual int trimLines();
 	/**
 	 * Draws the text using an efficient algorithm. 
      * @since 0.1.0
@@ -48,6 +48,8 @@
 #include "Agui/BlinkingEvent.hpp"
 #include "Agui/Widgets/TextBox/TextBoxListener.hpp"
 #include "Agui/Clipboard/Clipboard.hpp"
+#include "Agui/TextBuffer.hpp"
+#include <deque>
 
 namespace agui {
 	/**
@@ -82,10 +84,25 @@ namespace agui {
 		int mouseDownIndex;
 		int widestLine;
 		int numSelLines;
-		std::vector<std::string> textRows;
-		std::vector<int> lineOffset;
+		TextBuffer textBuffer;
+		std::deque<int> lineOffset;
 		std::vector<std::pair<Point,Point> > selPts;
-		std::vector<int> rowLengths;
+		std::deque<int> rowLengths;
+		std::deque<int> rowOffsets;
+		std::deque<int> rowWidths;
+		std::deque<int> paragraphRows;
+		std::deque<int> paragraphIndexes;
+		int paragraphRowBase;
+		int paragraphIndexBase;
+		int paragraphShiftStart;
+		int paragraphRowShift;
+		int paragraphIndexShift;
+		int layoutWidth;
+		int layoutLength;
+		bool hasPendingEdit;
+		int pendingEditIndex;
+		int pendingEditRemoved;
+		int pendingEditInserted;
 		Point selectionIndexes;
 		Color selectionBackColor;
     Color frameColor;
@@ -110,6 +127,8 @@ namespace agui {
 		bool readOnly;
 		bool drawBorder;
 		int maxLength;
+		int maxLineCount;
+		bool autoScrolling;
 		bool hotkeys;
 
 		ScrollPolicy hScrollPolicy;
@@ -124,7 +143,85 @@ namespace agui {
 		bool isMaintainingScrollInset;
 		std::vector<TextBoxListener*> textBoxListeners;
 		virtual void handleKeyboard(const KeyEvent &keyEvent);
+	/**
+	 * @return The width lines are wrapped to, or 0 when splitting by newline.
+     * @since 0.3.0
+     */
+		int getWrapWidth() const;
+	/**
+	 * Splits a single paragraph (text without newlines) into word wrapped rows.
+     * @since 0.3.0
+     */
+		void wrapParagraph(const std::string &paragraph, int width,
+			std::vector<std::string> &rows) const;
+	/**
+	 * Lays out the text from indexBegin to indexEnd and replaces the rows of
+	 * paragraphs firstParagraph through lastParagraph with the result.
+	 * Rows after the range are shifted. The paragraphs after it are
+	 * shifted lazily, see moveParagraphShift.
+     * @since 0.3.0
+     */
+		void relayoutParagraphs(int firstParagraph, int lastParagraph,
+			int indexBegin, int indexEnd, int width);
+	/**
+	 * Discards the current layout and lays out every paragraph.
+     * @since 0.3.0
+     */
+		void layoutAllParagraphs(int width);
+	/**
+	 * The paragraphs from paragraphShiftStart on still need the pending
+	 * row and index shift added. Moves that start to the parameter
+	 * paragraph, which only touches the paragraphs in between, so typing
+	 * in the same place does not shift every following paragraph.
+     * @since 0.3.0
+     */
+		void moveParagraphShift(int paragraph);
+	/**
+	 * Re-wraps only the paragraphs touched by the pending edit.
+	 * @return False if a full layout is needed instead.
+     * @since 0.3.0
+     */
+		bool layoutEditedParagraphs();
+	/**
+	 * @return The first row of the paragraph.
+     * @since 0.3.0
+     */
+		int getParagraphRow(int paragraph) const;
+	/**
+	 * @return The UTF8 index of the first character of the paragraph.
+     * @since 0.3.0
+     */
+		int getParagraphIndex(int paragraph) const;
+	/**
+	 * @return The last paragraph that starts at or before the UTF8 index.
+     * @since 0.3.0
+     */
+		int getParagraphAtIndex(int index) const;
+	/**
+	 * @return The paragraph that the row belongs to.
+     * @since 0.3.0
+     */
+		int getParagraphAtRow(int row) const;
+	/**
+	 * @return The UTF8 index of the first character of the row.
+     * @since 0.3.0
+     */
+		int getRowStart(int row) const;
+	/**
+	 * @return The first length UTF8 characters of the row.
+     * @since 0.3.0
+     */
+		std::string getRowText(int row, int length) const;
 	protected:
+	/**
+	 * Records the edit that the next call to updateText will apply so that
+	 * only the affected paragraphs are laid out again.
+	 * @param index The UTF8 index where the edit starts.
+	 * @param removedLength The number of UTF8 characters removed at index.
+	 * @param insertedLength The number of UTF8 characters inserted at index.
+     * @since 0.3.0
+     */
+		void setPendingEdit(int index, int removedLength, int insertedLength);
 	 /**
 	 * @return True if setThisText has been called and not returned yet.
      * @since 0.1.0
@@ -135,6 +232,23 @@ namespace agui {
      * @since 0.1.0
      */
 		void setThisText(const std::string &text);
+	/**
+	 * Stores the text, truncated to the max length, without laying it out
+	 * and tells the widget listeners that it changed.
+     * @since 0.3.0
+     */
+		void setBufferText(const std::string &text);
+	/**
+	 * Used internally to replace removedLength UTF8 characters at index with
+	 * text. Only the edited paragraphs are laid out again.
+     * @since 0.3.0
+     */
+		void editText(int index, int removedLength, const std::string &text);
+	/**
+	 * @return The buffer that stores the text.
+     * @since 0.3.0
+     */
+		const TextBuffer& getTextBuffer() const;
 	 /**
 	 * @return The width of the string. Modify this if you want to return
 	 * custom widths for Image characters like emoticons for a chat box.
@@ -275,6 +389,13 @@ namespace agui {
      */
 		virtual int addToNextCharacter(int unichar);
 	/**
+	 * Removes the oldest lines when there are more than the max line count.
+	 * Only the removed text is laid out again and the view stays on the same text.
+	 * @return The number of UTF8 characters removed from the start of the text.
+     * @since 0.3.0
+     */
+		virtual int trimLines();
+	/**
      * @return The number of lines in the TextBox.
      * @since 0.1.0
      */
@@ -283,7 +404,7 @@ namespace agui {
      * @return The UTF8 encoded string representing the parameter line.
      * @since 0.1.0
      */
-		virtual const std::string& getTextLineAt(int line) const;
+		virtual std::string getTextLineAt(int line) const;
 	/**
      * @return The Point, Point pair representing the Top Left, and Bottom Right points.
 	 * needed to construct the selection rectangle for this line. It is not given as a rectangle
@@ -378,6 +499,30 @@ namespace agui {
      * @since 0.1.0
      */
 		virtual void setMaxLength(int length);
+	/**
+	 * @return The maximum number of newline separated lines kept or 0 if there is no limit.
+     * @since 0.3.0
+     */
+		virtual int getMaxLineCount() const;
+	/**
+	 * Sets the maximum number of newline separated lines kept. When appending
+	 * text goes over it, the oldest lines are removed. Use 0 for no limit.
+	 * Useful with appendText for log consoles.
+     * @since 0.3.0
+     */
+		virtual void setMaxLineCount(int count);
+	/**
+	 * @return True if appending text while the last line is visible
+	 * scrolls down to the new text.
+     * @since 0.3.0
+     */
+		virtual bool isAutoScrolling() const;
+	/**
+	 * Sets whether appending text while the last line is visible scrolls down
+	 * to the new text. Only applies when the caret is not repositioned.
+     * @since 0.3.0
+     */
+		virtual void setAutoScrolling(bool autoScroll);
 	/**
 	 * @return True if the selection will be hidden 
 	 * when the TextBox is not focused.
@@ -602,6 +747,16 @@ namespace agui {
      */
 		virtual void scrollToCaret();
 		virtual void setText(const std::string &text);
+	/**
+     * @return The text. It is copied out of the text buffer after an edit.
+     * @since 0.3.0
+     */
+		virtual const std::string& getText() const;
+	/**
+     * @return The number of UTF8 characters.
+     * @since 0.3.0
+     */
+		virtual int getTextLength() const;
 		virtual void setSize(const Dimension &size );
 		virtual void setSize(int width, int height);
 	/**
@@ -0,0 +1,150 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AGUI_TEXT_STYLE_RUNS_HPP
+#define AGUI_TEXT_STYLE_RUNS_HPP
+#include "Agui/Platform.hpp"
+#include "Agui/Color.hpp"
+#include "Agui/Image.hpp"
+namespace agui
+{
+	/**
+	 * Class that stores a color and an optional image for each character of
+	 * a text as runs of characters that share them.
+	 *
+	 * The runs are kept in a balanced tree ordered by position so inserting,
+	 * erasing, recoloring and looking up characters is O(log n) in the number of runs.
+	 *
+	 * Used by ExtendedTextBox.
+     * @author Joshua Larouche
+     * @since 0.3.0
+     */
+	class AGUI_CORE_DECLSPEC TextStyleRuns
+	{
+		struct Node
+		{
+			Color color;
+			Image* image;
+			int length;
+			int total;
+			unsigned int priority;
+			Node* left;
+			Node* right;
+		};
+
+		Node* root;
+		int runCount;
+		unsigned int seed;
+
+		Node* createNode(const Color &color, Image* image, int length);
+		void destroy(Node* node);
+		static int getTotal(const Node* node);
+		static void update(Node* node);
+		static Node* merge(Node* left, Node* right);
+		void split(Node* node, int index, Node* &left, Node* &right);
+		static void recolor(Node* node, const Color &color);
+		static void grow(Node* node, int index, int count);
+		static bool isSameStyle(const Color &color, Image* image,
+			const Color &otherColor, Image* otherImage);
+
+		TextStyleRuns(const TextStyleRuns&);
+		TextStyleRuns& operator=(const TextStyleRuns&);
+	public:
+	/**
+	 * Default constructor.
+     * @since 0.3.0
+     */
+		TextStyleRuns();
+	/**
+	 * Inserts count characters with the parameter style before the character at index.
+	 * They join a neighboring run if it has the same style.
+     * @since 0.3.0
+     */
+		void insert(int index, int count, const Color &color, Image* image);
+	/**
+	 * Erases count characters starting at index.
+     * @since 0.3.0
+     */
+		void erase(int index, int count);
+	/**
+	 * Sets the color of count characters starting at index. Images are kept.
+     * @since 0.3.0
+     */
+		void setColor(int index, int count, const Color &color);
+	/**
+	 * Gets the style of the character at index.
+	 * @return The number of characters, starting at index, that share
+	 * this style in the same run or 0 if index is out of range.
+     * @since 0.3.0
+     */
+		int getRun(int index, Color &color, Image* &image) const;
+	/**
+	 * @return The color of the character at index.
+     * @since 0.3.0
+     */
+		Color getColorAt(int index) const;
+	/**
+	 * @return The image of the character at index or NULL.
+     * @since 0.3.0
+     */
+		Image* getImageAt(int index) const;
+	/**
+	 * @return The number of characters.
+     * @since 0.3.0
+     */
+		int getLength() const;
+	/**
+	 * @return The number of runs.
+     * @since 0.3.0
+     */
+		int getRunCount() const;
+	/**
+	 * Removes every character.
+     * @since 0.3.0
+     */
+		void clear();
+	/**
+	 * Default destructor.
+     * @since 0.3.0
+     */
+		virtual ~TextStyleRuns();
+	};
+}
+#endif
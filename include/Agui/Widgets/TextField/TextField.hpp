@@ -45,6 +45,7 @@
 #include "Agui/Widgets/TextField/TextFieldListener.hpp"
 #include "Agui/BlinkingEvent.hpp"
 #include "Agui/Clipboard/Clipboard.hpp"
+#include "Agui/TextBuffer.hpp"
 namespace agui {
 	/**
 	 * Class that represents a TextField.
@@ -98,6 +99,8 @@ namespace agui {
 		int selLength;
 		int selPos;
 
+		TextBuffer textBuffer;
+		mutable std::vector<int> textWidths;
 		std::vector<TextFieldListener*> tFieldListeners;
 
 	protected:
@@ -112,6 +115,29 @@ namespace agui {
      * @since 0.1.0
      */
 		virtual void setThisText(const std::string &text);
+	/**
+	 * Used internally to replace removedLength UTF8 characters at index
+	 * with text without copying the rest of the text.
+     * @since 0.3.0
+     */
+		void editText(int index, int removedLength, const std::string &text);
+	/**
+	 * Used internally to update the prefix widths after an edit. Only the
+	 * inserted text is measured and the widths after it are shifted.
+     * @since 0.3.0
+     */
+		void spliceTextWidths(int index, int removedLength, const std::string &text);
+	/**
+	 * @return The width of the first length UTF8 characters. The widths of
+	 * every prefix are measured in one pass and kept until the text or font changes.
+     * @since 0.3.0
+     */
+		int getPrefixWidth(int length) const;
+	/**
+	 * @return The widths of every prefix of the text, used for hit testing.
+     * @since 0.3.0
+     */
+		const std::vector<int>& getPrefixWidths() const;
 	/**
 	 * @return WIDTH - LEFT_PADDING - RIGHT_PADDING.
      * @since 0.1.0
@@ -423,6 +449,16 @@ namespace agui {
 		virtual void focusLost();
 		virtual void setText(const std::string &text);
 	/**
+     * @return The text. It is copied out of the text buffer after an edit.
+     * @since 0.3.0
+     */
+		virtual const std::string& getText() const;
+	/**
+     * @return The number of UTF8 characters.
+     * @since 0.3.0
+     */
+		virtual int getTextLength() const;
+	/**
 	 * Sets the maximum length in UTF8 characters. Calls to setText will be trimmed as well.
      * @since 0.1.0
      */
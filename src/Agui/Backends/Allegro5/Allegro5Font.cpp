@@ -65,6 +65,7 @@ namespace agui
   {
     if (font)
       free();
+    clearGlyphCache();
     font = al_load_font(fileName.c_str(),height,ALLEGRO_TTF_NO_KERNING | fontFlags);
 		if(!font && fileName != "")
 		{
@@ -109,6 +110,7 @@ namespace agui
 			free();
 		}
 		this->font = font;
+		clearGlyphCache();
 		if(!font)
 		{
 			throw Exception("Allegro5 was given a NULL font");
@@ -42,11 +42,18 @@
 #include "Agui/BaseTypes.hpp"
 
 namespace agui {
+	Allegro5Graphics::Allegro5Graphics()
+	: spriteClipKnown(false)
+	{
+	}
+
 	void Allegro5Graphics::setClippingRectangle
 	(const Rectangle &rect ) 
 	{
 		al_set_clipping_rectangle(rect.getX(),rect.getY(),
 			rect.getWidth(),rect.getHeight());
+		setSpriteClippingRectangle(rect);
+		spriteClipKnown = true;
 	}
 
 
@@ -54,10 +61,8 @@ namespace agui {
 												const Point &position, 
 												const float &opacity )
 	{
-		if(((Allegro5Image*)bmp)->getBitmap())
-			al_draw_tinted_bitmap(((Allegro5Image*)bmp)->getBitmap(),
-			al_map_rgba_f(opacity,opacity,opacity,opacity),
-			position.getX() + getOffset().getX(),position.getY() + getOffset().getY(),0);
+		Dimension size(bmp->getWidth(),bmp->getHeight());
+		drawScaledImage(bmp,position,Point(0,0),size,size,opacity);
 	}
 
 	void Allegro5Graphics::drawImage( const Image *bmp,
@@ -66,12 +71,7 @@ namespace agui {
 												const Dimension &regionSize,
 												const float &opacity /*= 1.0f*/ )
 	{
-		if(((Allegro5Image*)bmp)->getBitmap())
-		al_draw_tinted_bitmap_region(((Allegro5Image*)bmp)->getBitmap(),
-			al_map_rgba_f(opacity,opacity,opacity,opacity),
-			regionStart.getX(),regionStart.getY(),
-			regionSize.getWidth(),regionSize.getHeight(),
-			position.getX() + getOffset().getX(),position.getY() + getOffset().getY(), 0);
+		drawScaledImage(bmp,position,regionStart,regionSize,regionSize,opacity);
 	}
 
 	Rectangle Allegro5Graphics::getClippingRectangle()
@@ -94,13 +94,81 @@ namespace agui {
 													  const Dimension &scale, 
 													  const float &opacity /*= 1.0f*/ )
 	{
-		if(((Allegro5Image*)bmp)->getBitmap())
-		al_draw_tinted_scaled_bitmap(((Allegro5Image*)bmp)->getBitmap(),
-			al_map_rgba_f(opacity,opacity,opacity,opacity),
-			regionStart.getX(),regionStart.getY(),
-			regionScale.getWidth(),regionScale.getHeight(),
-			position.getX() + getOffset().getX(),position.getY() + getOffset().getY(),
-			scale.getWidth(),scale.getHeight(),0);
+		const Allegro5Image* image = (const Allegro5Image*)bmp;
+		if(!image->getBitmap() || scale.getWidth() <= 0 || scale.getHeight() <= 0)
+		{
+			return;
+		}
+
+		if(!spriteClipKnown)
+		{
+			setSpriteClippingRectangle(getClippingRectangle());
+			spriteClipKnown = true;
+		}
+
+		addSprite(image->getTexture(),
+			Rectangle(image->getTextureX(),image->getTextureY(),
+			image->getWidth(),image->getHeight()),
+			Rectangle(position.getX() + getOffset().getX(),
+			position.getY() + getOffset().getY(),
+			scale.getWidth(),scale.getHeight()),
+			Rectangle(regionStart,regionScale),opacity);
+	}
+
+	void Allegro5Graphics::drawSprites( const void* texture,
+		const std::vector<Sprite> &sprites )
+	{
+		vertices.resize(sprites.size() * 6);
+		for(size_t i = 0; i < sprites.size(); ++i)
+		{
+			const Sprite& s = sprites[i];
+			float scaleX = float(s.source.getWidth()) / float(s.destination.getWidth());
+			float scaleY = float(s.source.getHeight()) / float(s.destination.getHeight());
+			float srcX = float(s.bounds.getX() + s.source.getX());
+			float srcY = float(s.bounds.getY() + s.source.getY());
+
+			//texture coordinates are in pixels
+			float u0 = srcX + (s.visible.getLeft() - s.destination.getLeft()) * scaleX;
+			float v0 = srcY + (s.visible.getTop() - s.destination.getTop()) * scaleY;
+			float u1 = srcX + (s.visible.getRight() - s.destination.getLeft()) * scaleX;
+			float v1 = srcY + (s.visible.getBottom() - s.destination.getTop()) * scaleY;
+			float x0 = float(s.visible.getLeft());
+			float y0 = float(s.visible.getTop());
+			float x1 = float(s.visible.getRight());
+			float y1 = float(s.visible.getBottom());
+			ALLEGRO_COLOR tint = al_map_rgba_f(s.opacity,s.opacity,s.opacity,s.opacity);
+
+			ALLEGRO_VERTEX* v = &vertices[i * 6];
+			float xs[6] = {x0,x1,x0,x1,x1,x0};
+			float ys[6] = {y0,y0,y1,y0,y1,y1};
+			float us[6] = {u0,u1,u0,u1,u1,u0};
+			float vs[6] = {v0,v0,v1,v0,v1,v1};
+			for(int j = 0; j < 6; ++j)
+			{
+				v[j].x = xs[j];
+				v[j].y = ys[j];
+				v[j].z = 0.0f;
+				v[j].u = us[j];
+				v[j].v = vs[j];
+				v[j].color = tint;
+			}
+		}
+
+		//sprites were clipped when they were added, possibly to
+		//other rectangles than the current one
+		int x = 0;
+		int y = 0;
+		int width = 0;
+		int height = 0;
+		ALLEGRO_BITMAP* target = al_get_target_bitmap();
+		al_get_clipping_rectangle(&x,&y,&width,&height);
+		al_set_clipping_rectangle(0,0,al_get_bitmap_width(target),
+			al_get_bitmap_height(target));
+
+		al_draw_prim(&vertices[0],NULL,(ALLEGRO_BITMAP*)texture,
+			0,int(vertices.size()),ALLEGRO_PRIM_TRIANGLE_LIST);
+
+		al_set_clipping_rectangle(x,y,width,height);
 	}
 
 
@@ -110,6 +178,8 @@ namespace agui {
 	( const Point &position,const char* text,const Color &color, 
 	 const Font *font, AlignmentEnum align /*= ALIGN_LEFT*/ )
 	{
+		flushSprites();
+
 		if( font && ((Allegro5Font*)font)->getFont())
 		al_draw_text(((Allegro5Font*)font)->getFont(),getColor(color),
 			position.getX() + getOffset().getX(),position.getY() + getOffset().getY(),align,text);
@@ -119,6 +189,8 @@ namespace agui {
 	void Allegro5Graphics::drawRectangle( const Rectangle &rect, 
 													const Color &color)
 	{
+		flushSprites();
+
 		al_draw_rectangle(
 			float(rect.getLeft() + getOffset().getX()) + 0.5f,
 			float(rect.getTop() + getOffset().getY()) + 0.5f,
@@ -130,6 +202,8 @@ namespace agui {
 	void Allegro5Graphics::drawFilledRectangle
 	( const Rectangle &rect, const Color &color )
 	{
+		flushSprites();
+
 		al_draw_filled_rectangle(rect.getLeft() + getOffset().getX(),
 			rect.getTop() + getOffset().getY(),
 			rect.getRight() + getOffset().getX()
@@ -139,12 +213,16 @@ namespace agui {
 	void Allegro5Graphics::drawPixel( const Point &point,
 												const Color &color )
 	{
+		flushSprites();
+
 		al_put_blended_pixel(point.getX() + getOffset().getX() + 0.5f,
 			point.getY() + getOffset().getY() + 0.5f,getColor(color));
 	}
 
 	void Allegro5Graphics::setTargetImage( const Image *target )
 	{
+		flushSprites();
+		spriteClipKnown = false;
 
 		al_set_target_bitmap(((Allegro5Image*)target)->getBitmap());
 
@@ -152,6 +230,8 @@ namespace agui {
 
 	void Allegro5Graphics::resetTargetImage()
 	{
+		flushSprites();
+		spriteClipKnown = false;
 		al_set_target_bitmap(al_get_backbuffer
 			(al_get_current_display()));
 	}
@@ -176,6 +256,8 @@ namespace agui {
 												 float radius, 
 												 const Color &color )
 	{
+		flushSprites();
+
 		al_draw_circle(center.getX() + getOffset().getX(),center.getY() + getOffset().getY(),
 			radius,getColor(color),1);
 	}
@@ -184,6 +266,8 @@ namespace agui {
 													   float radius,
 													   const Color &color )
 	{
+		flushSprites();
+
 		al_draw_filled_circle(center.getX() + getOffset().getX(),
 	center.getY() + getOffset().getY(),
 			radius,getColor(color));
@@ -193,6 +277,7 @@ namespace agui {
 											   const Point &end,
 											   const Color &color)
 	{
+		flushSprites();
 
 			al_draw_line(
 				start.getX() + getOffset().getX(),
@@ -210,6 +295,11 @@ namespace agui {
 
 	void Allegro5Graphics::_endPaint()
 	{
-		//stub
+		flushSprites();
+	}
+
+	void Allegro5Graphics::flush()
+	{
+		flushSprites();
 	}
 }
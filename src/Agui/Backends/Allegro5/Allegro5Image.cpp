@@ -44,12 +44,14 @@ namespace agui
 {
 
 	Allegro5Image::Allegro5Image(void)
-	: bmp(NULL), width(0), height(0), autoFree(false)
+	: bmp(NULL), width(0), height(0), autoFree(false),
+	page(NULL), pageX(0), pageY(0)
 	{
 	}
 
 	Allegro5Image::~Allegro5Image(void)
 	{
+		unlock();
 		if(bmp && autoFree)
 		{
 			al_destroy_bitmap(bmp);
@@ -58,7 +60,7 @@ namespace agui
 	}
 
 	Allegro5Image::Allegro5Image( const std::string& fileName, bool convertMask /*= false*/ )
-		:autoFree(true)
+		:autoFree(true), page(NULL), pageX(0), pageY(0)
 	{
 		bmp = al_load_bitmap(fileName.c_str());
 		if(!bmp)
@@ -89,33 +91,42 @@ namespace agui
 		return bmp;
 	}
 
-	Color Allegro5Image::getPixel( int x, int y ) const
+	bool Allegro5Image::lockRegion( const Rectangle &region,
+		PixelLockEnum mode, PixelSpan &pixels )
 	{
 		if(!bmp)
 		{
-			throw Exception("Cannot obtain the pixel of a NULL image");
+			return false;
 		}
-		ALLEGRO_COLOR c = al_get_pixel(bmp, x, y);
 
-		unsigned char r,g,b,a;
-		al_unmap_rgba(c, &r, &g, &b, &a);
-
-		return Color(r, g, b, a);;
-	}
+		int flags = ALLEGRO_LOCK_READWRITE;
+		if(mode == LOCK_READ_ONLY)
+		{
+			flags = ALLEGRO_LOCK_READONLY;
+		}
+		else if(mode == LOCK_WRITE_ONLY)
+		{
+			flags = ALLEGRO_LOCK_WRITEONLY;
+		}
 
-	void Allegro5Image::setPixel( int x, int y, const Color& color )
-	{
-		if(!bmp)
+		//ABGR 8888 LE is R, G, B, A in memory on every platform,
+		//Allegro converts from the bitmap format if it differs
+		ALLEGRO_LOCKED_REGION* locked = al_lock_bitmap_region(bmp,
+			region.getX(),region.getY(),region.getWidth(),region.getHeight(),
+			ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE,flags);
+		if(!locked)
 		{
-			throw Exception("Cannot set the pixel of a NULL image");
+			return false;
 		}
 
-		ALLEGRO_COLOR c = al_map_rgba_f(color.getR(),color.getG(),color.getB(),color.getA());
-		ALLEGRO_BITMAP* oldBmp = al_get_target_bitmap();
+		pixels = PixelSpan((unsigned char*)locked->data,locked->pitch,
+			PIXEL_FORMAT_RGBA_8888,region.getWidth(),region.getHeight());
+		return true;
+	}
 
-		al_set_target_bitmap(bmp);
-		al_put_pixel(x, y, c);
-		al_set_target_bitmap(oldBmp);
+	void Allegro5Image::unlockRegion()
+	{
+		al_unlock_bitmap(bmp);
 	}
 
 	bool Allegro5Image::isAutoFreeing() const
@@ -125,12 +136,14 @@ namespace agui
 
 	void Allegro5Image::free()
 	{
+			unlock();
 			al_destroy_bitmap(bmp);
 			bmp = NULL;
 	}
 
 	void Allegro5Image::setBitmap( ALLEGRO_BITMAP* bitmap, bool autoFree /*= false*/ )
 	{
+		unlock();
 		if(this->autoFree)
 		{
 			free();
@@ -139,7 +152,32 @@ namespace agui
 		width = al_get_bitmap_width(bmp);
 		height = al_get_bitmap_height(bmp);
 		this->autoFree = autoFree;
+		page = NULL;
+		pageX = 0;
+		pageY = 0;
+
+	}
+
+	void Allegro5Image::_setAtlasPage( ALLEGRO_BITMAP* page, int x, int y )
+	{
+		this->page = page;
+		pageX = x;
+		pageY = y;
+	}
 
+	ALLEGRO_BITMAP* Allegro5Image::getTexture() const
+	{
+		return page ? page : bmp;
+	}
+
+	int Allegro5Image::getTextureX() const
+	{
+		return pageX;
+	}
+
+	int Allegro5Image::getTextureY() const
+	{
+		return pageY;
 	}
 
 
@@ -0,0 +1,107 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/Backends/Allegro5/Allegro5ImageAtlas.hpp"
+
+namespace agui
+{
+	Allegro5ImageAtlas::Allegro5ImageAtlas( int pageWidth /*= 1024*/,
+		int pageHeight /*= 1024*/, int padding /*= 1*/ )
+	: ImageAtlas(pageWidth,pageHeight,padding)
+	{
+	}
+
+	Allegro5ImageAtlas::~Allegro5ImageAtlas(void)
+	{
+		for(size_t i = 0; i < pages.size(); ++i)
+		{
+			al_destroy_bitmap(pages[i]);
+		}
+	}
+
+	void Allegro5ImageAtlas::createPage( int page, int width, int height )
+	{
+		ALLEGRO_BITMAP* bmp = al_create_bitmap(width,height);
+		if(!bmp)
+		{
+			throw Exception("Agui Allegro 5 Failed to create atlas page");
+		}
+
+		ALLEGRO_STATE state;
+		al_store_state(&state,ALLEGRO_STATE_TARGET_BITMAP);
+		al_set_target_bitmap(bmp);
+		al_clear_to_color(al_map_rgba(0,0,0,0));
+		al_restore_state(&state);
+
+		pages.push_back(bmp);
+	}
+
+	void Allegro5ImageAtlas::placeImage( Image* image, int page, const Point &position )
+	{
+		Allegro5Image* img = (Allegro5Image*)image;
+		ALLEGRO_BITMAP* bmp = img->getBitmap();
+		ALLEGRO_BITMAP* target = pages[page];
+		int w = img->getWidth();
+		int h = img->getHeight();
+
+		//copy the pixels as they are, alpha included
+		ALLEGRO_STATE state;
+		al_store_state(&state,ALLEGRO_STATE_TARGET_BITMAP | ALLEGRO_STATE_BLENDER);
+		al_set_target_bitmap(target);
+		al_set_blender(ALLEGRO_ADD,ALLEGRO_ONE,ALLEGRO_ZERO);
+		al_draw_bitmap(bmp,position.getX(),position.getY(),0);
+		al_restore_state(&state);
+
+		ALLEGRO_BITMAP* sub = al_create_sub_bitmap(target,
+			position.getX(),position.getY(),w,h);
+		if(!sub)
+		{
+			throw Exception("Agui Allegro 5 Failed to create atlas sub bitmap");
+		}
+
+		img->setBitmap(sub,true);
+		img->_setAtlasPage(target,position.getX(),position.getY());
+	}
+
+	ALLEGRO_BITMAP* Allegro5ImageAtlas::getPage( int page ) const
+	{
+		return pages[page];
+	}
+}
@@ -0,0 +1,223 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/Backends/Software/SoftwareFont.hpp"
+
+namespace agui
+{
+	//public domain 8x8 glyphs for ' ' to '~'
+	static const unsigned char asciiGlyphs[95][8] = {
+		{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+		{0x18,0x3C,0x3C,0x18,0x18,0x00,0x18,0x00},
+		{0x36,0x36,0x00,0x00,0x00,0x00,0x00,0x00},
+		{0x36,0x36,0x7F,0x36,0x7F,0x36,0x36,0x00},
+		{0x0C,0x3E,0x03,0x1E,0x30,0x1F,0x0C,0x00},
+		{0x00,0x63,0x33,0x18,0x0C,0x66,0x63,0x00},
+		{0x1C,0x36,0x1C,0x6E,0x3B,0x33,0x6E,0x00},
+		{0x06,0x06,0x03,0x00,0x00,0x00,0x00,0x00},
+		{0x18,0x0C,0x06,0x06,0x06,0x0C,0x18,0x00},
+		{0x06,0x0C,0x18,0x18,0x18,0x0C,0x06,0x00},
+		{0x00,0x66,0x3C,0xFF,0x3C,0x66,0x00,0x00},
+		{0x00,0x0C,0x0C,0x3F,0x0C,0x0C,0x00,0x00},
+		{0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x06},
+		{0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00},
+		{0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x00},
+		{0x60,0x30,0x18,0x0C,0x06,0x03,0x01,0x00},
+		{0x3E,0x63,0x73,0x7B,0x6F,0x67,0x3E,0x00},
+		{0x0C,0x0E,0x0C,0x0C,0x0C,0x0C,0x3F,0x00},
+		{0x1E,0x33,0x30,0x1C,0x06,0x33,0x3F,0x00},
+		{0x1E,0x33,0x30,0x1C,0x30,0x33,0x1E,0x00},
+		{0x38,0x3C,0x36,0x33,0x7F,0x30,0x78,0x00},
+		{0x3F,0x03,0x1F,0x30,0x30,0x33,0x1E,0x00},
+		{0x1C,0x06,0x03,0x1F,0x33,0x33,0x1E,0x00},
+		{0x3F,0x33,0x30,0x18,0x0C,0x0C,0x0C,0x00},
+		{0x1E,0x33,0x33,0x1E,0x33,0x33,0x1E,0x00},
+		{0x1E,0x33,0x33,0x3E,0x30,0x18,0x0E,0x00},
+		{0x00,0x0C,0x0C,0x00,0x00,0x0C,0x0C,0x00},
+		{0x00,0x0C,0x0C,0x00,0x00,0x0C,0x0C,0x06},
+		{0x18,0x0C,0x06,0x03,0x06,0x0C,0x18,0x00},
+		{0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00},
+		{0x06,0x0C,0x18,0x30,0x18,0x0C,0x06,0x00},
+		{0x1E,0x33,0x30,0x18,0x0C,0x00,0x0C,0x00},
+		{0x3E,0x63,0x7B,0x7B,0x7B,0x03,0x1E,0x00},
+		{0x0C,0x1E,0x33,0x33,0x3F,0x33,0x33,0x00},
+		{0x3F,0x66,0x66,0x3E,0x66,0x66,0x3F,0x00},
+		{0x3C,0x66,0x03,0x03,0x03,0x66,0x3C,0x00},
+		{0x1F,0x36,0x66,0x66,0x66,0x36,0x1F,0x00},
+		{0x7F,0x46,0x16,0x1E,0x16,0x46,0x7F,0x00},
+		{0x7F,0x46,0x16,0x1E,0x16,0x06,0x0F,0x00},
+		{0x3C,0x66,0x03,0x03,0x73,0x66,0x7C,0x00},
+		{0x33,0x33,0x33,0x3F,0x33,0x33,0x33,0x00},
+		{0x1E,0x0C,0x0C,0x0C,0x0C,0x0C,0x1E,0x00},
+		{0x78,0x30,0x30,0x30,0x33,0x33,0x1E,0x00},
+		{0x67,0x66,0x36,0x1E,0x36,0x66,0x67,0x00},
+		{0x0F,0x06,0x06,0x06,0x46,0x66,0x7F,0x00},
+		{0x63,0x77,0x7F,0x7F,0x6B,0x63,0x63,0x00},
+		{0x63,0x67,0x6F,0x7B,0x73,0x63,0x63,0x00},
+		{0x1C,0x36,0x63,0x63,0x63,0x36,0x1C,0x00},
+		{0x3F,0x66,0x66,0x3E,0x06,0x06,0x0F,0x00},
+		{0x1E,0x33,0x33,0x33,0x3B,0x1E,0x38,0x00},
+		{0x3F,0x66,0x66,0x3E,0x36,0x66,0x67,0x00},
+		{0x1E,0x33,0x07,0x0E,0x38,0x33,0x1E,0x00},
+		{0x3F,0x2D,0x0C,0x0C,0x0C,0x0C,0x1E,0x00},
+		{0x33,0x33,0x33,0x33,0x33,0x33,0x3F,0x00},
+		{0x33,0x33,0x33,0x33,0x33,0x1E,0x0C,0x00},
+		{0x63,0x63,0x63,0x6B,0x7F,0x77,0x63,0x00},
+		{0x63,0x63,0x36,0x1C,0x1C,0x36,0x63,0x00},
+		{0x33,0x33,0x33,0x1E,0x0C,0x0C,0x1E,0x00},
+		{0x7F,0x63,0x31,0x18,0x4C,0x66,0x7F,0x00},
+		{0x1E,0x06,0x06,0x06,0x06,0x06,0x1E,0x00},
+		{0x03,0x06,0x0C,0x18,0x30,0x60,0x40,0x00},
+		{0x1E,0x18,0x18,0x18,0x18,0x18,0x1E,0x00},
+		{0x08,0x1C,0x36,0x63,0x00,0x00,0x00,0x00},
+		{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF},
+		{0x0C,0x0C,0x18,0x00,0x00,0x00,0x00,0x00},
+		{0x00,0x00,0x1E,0x30,0x3E,0x33,0x6E,0x00},
+		{0x07,0x06,0x06,0x3E,0x66,0x66,0x3B,0x00},
+		{0x00,0x00,0x1E,0x33,0x03,0x33,0x1E,0x00},
+		{0x38,0x30,0x30,0x3E,0x33,0x33,0x6E,0x00},
+		{0x00,0x00,0x1E,0x33,0x3F,0x03,0x1E,0x00},
+		{0x1C,0x36,0x06,0x0F,0x06,0x06,0x0F,0x00},
+		{0x00,0x00,0x6E,0x33,0x33,0x3E,0x30,0x1F},
+		{0x07,0x06,0x36,0x6E,0x66,0x66,0x67,0x00},
+		{0x0C,0x00,0x0E,0x0C,0x0C,0x0C,0x1E,0x00},
+		{0x30,0x00,0x30,0x30,0x30,0x33,0x33,0x1E},
+		{0x07,0x06,0x66,0x36,0x1E,0x36,0x67,0x00},
+		{0x0E,0x0C,0x0C,0x0C,0x0C,0x0C,0x1E,0x00},
+		{0x00,0x00,0x33,0x7F,0x7F,0x6B,0x63,0x00},
+		{0x00,0x00,0x1F,0x33,0x33,0x33,0x33,0x00},
+		{0x00,0x00,0x1E,0x33,0x33,0x33,0x1E,0x00},
+		{0x00,0x00,0x3B,0x66,0x66,0x3E,0x06,0x0F},
+		{0x00,0x00,0x6E,0x33,0x33,0x3E,0x30,0x78},
+		{0x00,0x00,0x3B,0x6E,0x66,0x06,0x0F,0x00},
+		{0x00,0x00,0x3E,0x03,0x1E,0x30,0x1F,0x00},
+		{0x08,0x0C,0x3E,0x0C,0x0C,0x2C,0x18,0x00},
+		{0x00,0x00,0x33,0x33,0x33,0x33,0x6E,0x00},
+		{0x00,0x00,0x33,0x33,0x33,0x1E,0x0C,0x00},
+		{0x00,0x00,0x63,0x6B,0x7F,0x7F,0x36,0x00},
+		{0x00,0x00,0x63,0x36,0x1C,0x36,0x63,0x00},
+		{0x00,0x00,0x33,0x33,0x33,0x3E,0x30,0x1F},
+		{0x00,0x00,0x3F,0x19,0x0C,0x26,0x3F,0x00},
+		{0x38,0x0C,0x0C,0x07,0x0C,0x0C,0x38,0x00},
+		{0x18,0x18,0x18,0x00,0x18,0x18,0x18,0x00},
+		{0x07,0x0C,0x0C,0x38,0x0C,0x0C,0x07,0x00},
+		{0x6E,0x3B,0x00,0x00,0x00,0x00,0x00,0x00}
+	};
+
+	SoftwareFont::SoftwareFont(void)
+	: scale(1)
+	{
+	}
+
+	SoftwareFont::SoftwareFont( const std::string &fileName, int height, FontFlags fontFlags, float borderWidth, agui::Color borderColor )
+	: scale(1)
+	{
+		reload(fileName,height,fontFlags,borderWidth,borderColor);
+	}
+
+	SoftwareFont::~SoftwareFont(void)
+	{
+	}
+
+	void SoftwareFont::reload( const std::string &fileName, int height, FontFlags fontFlags, float borderWidth, agui::Color borderColor )
+	{
+		//the glyphs are built in so the file is only kept as the path
+		(void)fontFlags;
+		(void)borderWidth;
+		(void)borderColor;
+		clearGlyphCache();
+		path = fileName;
+		scale = height / GLYPH_SIZE;
+		if(scale < 1)
+		{
+			scale = 1;
+		}
+	}
+
+	void SoftwareFont::free()
+	{
+	}
+
+	int SoftwareFont::getLineHeight() const
+	{
+		return GLYPH_SIZE * scale;
+	}
+
+	int SoftwareFont::getHeight() const
+	{
+		return GLYPH_SIZE * scale;
+	}
+
+	int SoftwareFont::getTextWidth( const std::string &text ) const
+	{
+		int count = 0;
+		for(size_t i = 0; i < text.length(); ++i)
+		{
+			//count the first byte of each UTF8 character
+			if(((unsigned char)text[i] & 0xC0) != 0x80)
+			{
+				count++;
+			}
+		}
+
+		return count * GLYPH_SIZE * scale;
+	}
+
+	const std::string& SoftwareFont::getPath() const
+	{
+		return path;
+	}
+
+	int SoftwareFont::getScale() const
+	{
+		return scale;
+	}
+
+	const unsigned char* SoftwareFont::getGlyph( unsigned int unichar )
+	{
+		if(unichar < 32 || unichar > 126)
+		{
+			return NULL;
+		}
+
+		return asciiGlyphs[unichar - 32];
+	}
+
+}
@@ -0,0 +1,550 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/Backends/Software/SoftwareGraphics.hpp"
+#include "Agui/UTF8.hpp"
+#include <cmath>
+
+namespace agui {
+
+	SoftwareGraphics::SoftwareGraphics( int width, int height )
+	: display(width,height), target(&display)
+	{
+		resetClipArea();
+	}
+
+	void SoftwareGraphics::resetClipArea()
+	{
+		clipArea = Rectangle(0,0,target->getWidth(),target->getHeight());
+		setSpriteClippingRectangle(clipArea);
+	}
+
+	void SoftwareGraphics::setClippingRectangle( const Rectangle &rect )
+	{
+		int left = rect.getLeft() > 0 ? rect.getLeft() : 0;
+		int top = rect.getTop() > 0 ? rect.getTop() : 0;
+		int right = rect.getRight() < target->getWidth() ?
+			rect.getRight() : target->getWidth();
+		int bottom = rect.getBottom() < target->getHeight() ?
+			rect.getBottom() : target->getHeight();
+
+		if(right < left)
+		{
+			right = left;
+		}
+		if(bottom < top)
+		{
+			bottom = top;
+		}
+
+		clipArea = Rectangle(left,top,right - left,bottom - top);
+		setSpriteClippingRectangle(clipArea);
+	}
+
+	Rectangle SoftwareGraphics::getClippingRectangle()
+	{
+		return clipArea;
+	}
+
+	void SoftwareGraphics::makeColor( const Color &color, unsigned char *result ) const
+	{
+		float channels[4] = {color.getR(),color.getG(),color.getB(),color.getA()};
+		for(int i = 0; i < 4; ++i)
+		{
+			if(channels[i] <= 0.0f)
+			{
+				result[i] = 0;
+			}
+			else if(channels[i] >= 1.0f)
+			{
+				result[i] = 255;
+			}
+			else
+			{
+				result[i] = (unsigned char)(channels[i] * 255.0f + 0.5f);
+			}
+		}
+	}
+
+	void SoftwareGraphics::blendPixel( int x, int y, const unsigned char *color )
+	{
+		if(x < clipArea.getLeft() || x >= clipArea.getRight() ||
+			y < clipArea.getTop() || y >= clipArea.getBottom())
+		{
+			return;
+		}
+
+		blend(target->getData() + y * target->getPitch() + x * 4,color);
+	}
+
+	void SoftwareGraphics::blend( unsigned char *dst, const unsigned char *color )
+	{
+		if(color[3] == 255)
+		{
+			dst[0] = color[0];
+			dst[1] = color[1];
+			dst[2] = color[2];
+			dst[3] = 255;
+			return;
+		}
+
+		int inverse = 255 - color[3];
+		for(int i = 0; i < 4; ++i)
+		{
+			int value = color[i] + (dst[i] * inverse + 127) / 255;
+			dst[i] = (unsigned char)(value > 255 ? 255 : value);
+		}
+	}
+
+	void SoftwareGraphics::blendSpan( int left, int right, int y, const unsigned char *color )
+	{
+		if(y < clipArea.getTop() || y >= clipArea.getBottom())
+		{
+			return;
+		}
+		if(left < clipArea.getLeft())
+		{
+			left = clipArea.getLeft();
+		}
+		if(right > clipArea.getRight())
+		{
+			right = clipArea.getRight();
+		}
+
+		for(int x = left; x < right; ++x)
+		{
+			blendPixel(x,y,color);
+		}
+	}
+
+	void SoftwareGraphics::drawImage( const Image *bmp,
+												const Point &position, 
+												const float &opacity )
+	{
+		drawImage(bmp,position,Point(0,0),
+			Dimension(bmp->getWidth(),bmp->getHeight()),opacity);
+	}
+
+	void SoftwareGraphics::drawImage( const Image *bmp,
+												const Point &position,
+												const Point &regionStart,
+												const Dimension &regionSize,
+												const float &opacity /*= 1.0f*/ )
+	{
+		drawScaledImage(bmp,position,regionStart,regionSize,regionSize,opacity);
+	}
+
+	void SoftwareGraphics::drawScaledImage( const Image *bmp,
+													  const Point &position,
+													  const Point &regionStart,
+													  const Dimension &regionScale,
+													  const Dimension &scale, 
+													  const float &opacity /*= 1.0f*/ )
+	{
+		const SoftwareImage* image = (const SoftwareImage*)bmp;
+		if(!image->getData() || scale.getWidth() <= 0 || scale.getHeight() <= 0)
+		{
+			return;
+		}
+
+		addSprite(image->getTexture(),
+			Rectangle(image->getTextureX(),image->getTextureY(),
+			image->getWidth(),image->getHeight()),
+			Rectangle(position.getX() + getOffset().getX(),
+			position.getY() + getOffset().getY(),
+			scale.getWidth(),scale.getHeight()),
+			Rectangle(regionStart,regionScale),opacity);
+	}
+
+	void SoftwareGraphics::drawSprites( const void* texture,
+		const std::vector<Sprite> &sprites )
+	{
+		const SoftwareImage* image = (const SoftwareImage*)texture;
+		const unsigned char* data = image->getData();
+		int pitch = image->getPitch();
+
+		for(std::vector<Sprite>::const_iterator it = sprites.begin();
+			it != sprites.end(); ++it)
+		{
+			const Rectangle &dest = it->destination;
+			const Rectangle &src = it->source;
+			const Rectangle &bounds = it->bounds;
+			int tint = it->opacity <= 0.0f ? 0 : it->opacity >= 1.0f ?
+				255 : int(it->opacity * 255.0f + 0.5f);
+
+			//the visible part is sampled as if the whole region was drawn
+			for(int y = it->visible.getTop(); y < it->visible.getBottom(); ++y)
+			{
+				int sy = src.getY() + (y - dest.getY()) * src.getHeight() / dest.getHeight();
+				if(sy < 0 || sy >= bounds.getHeight())
+				{
+					continue;
+				}
+
+				const unsigned char* row = data + (bounds.getY() + sy) * pitch + bounds.getX() * 4;
+				unsigned char* dst = target->getData() + y * target->getPitch();
+
+				for(int x = it->visible.getLeft(); x < it->visible.getRight(); ++x)
+				{
+					int sx = src.getX() + (x - dest.getX()) * src.getWidth() / dest.getWidth();
+					if(sx < 0 || sx >= bounds.getWidth())
+					{
+						continue;
+					}
+
+					if(tint == 255)
+					{
+						blend(dst + x * 4,row + sx * 4);
+					}
+					else
+					{
+						unsigned char tinted[4];
+						for(int i = 0; i < 4; ++i)
+						{
+							tinted[i] = (unsigned char)((row[sx * 4 + i] * tint + 127) / 255);
+						}
+						blend(dst + x * 4,tinted);
+					}
+				}
+			}
+		}
+	}
+
+	void SoftwareGraphics::drawText
+	( const Point &position,const char* text,const Color &color, 
+	 const Font *font, AlignmentEnum align /*= ALIGN_LEFT*/ )
+	{
+		flushSprites();
+
+		if(!font || !text)
+		{
+			return;
+		}
+
+		std::string str = text;
+		int scale = ((const SoftwareFont*)font)->getScale();
+		int size = SoftwareFont::GLYPH_SIZE * scale;
+		int x = position.getX() + getOffset().getX();
+		int y = position.getY() + getOffset().getY();
+
+		if(align == ALIGN_CENTER)
+		{
+			x -= font->getTextWidth(str) / 2;
+		}
+		else if(align == ALIGN_RIGHT)
+		{
+			x -= font->getTextWidth(str);
+		}
+
+		unsigned char c[4];
+		makeColor(color,c);
+
+		UTF8 utf8;
+		size_t index = 0;
+		while(index < str.length())
+		{
+			size_t start = index;
+			size_t length = utf8.bringToNextUnichar(index,str);
+			int unichar = utf8.decodeUtf8(&str[start],length);
+
+			const unsigned char* glyph = SoftwareFont::getGlyph(unichar);
+			if(glyph)
+			{
+				for(int row = 0; row < SoftwareFont::GLYPH_SIZE; ++row)
+				{
+					for(int col = 0; col < SoftwareFont::GLYPH_SIZE; ++col)
+					{
+						if(glyph[row] & (1 << col))
+						{
+							for(int sy = 0; sy < scale; ++sy)
+							{
+								blendSpan(x + col * scale,x + (col + 1) * scale,
+									y + row * scale + sy,c);
+							}
+						}
+					}
+				}
+			}
+			else if(unichar != ' ')
+			{
+				//characters without a glyph are drawn as a box
+				drawRectangle(Rectangle(x - getOffset().getX() + scale,
+					y - getOffset().getY() + scale,size - 2 * scale,size - 2 * scale),color);
+			}
+
+			x += size;
+		}
+	}
+
+	void SoftwareGraphics::drawRectangle( const Rectangle &rect, 
+													const Color &color)
+	{
+		flushSprites();
+
+		if(rect.getWidth() <= 0 || rect.getHeight() <= 0)
+		{
+			return;
+		}
+
+		unsigned char c[4];
+		makeColor(color,c);
+
+		int left = rect.getLeft() + getOffset().getX();
+		int top = rect.getTop() + getOffset().getY();
+		int right = rect.getRight() + getOffset().getX();
+		int bottom = rect.getBottom() + getOffset().getY();
+
+		blendSpan(left,right,top,c);
+		if(bottom - 1 > top)
+		{
+			blendSpan(left,right,bottom - 1,c);
+		}
+
+		for(int y = top + 1; y < bottom - 1; ++y)
+		{
+			blendPixel(left,y,c);
+			if(right - 1 > left)
+			{
+				blendPixel(right - 1,y,c);
+			}
+		}
+	}
+
+	void SoftwareGraphics::drawFilledRectangle
+	( const Rectangle &rect, const Color &color )
+	{
+		flushSprites();
+
+		unsigned char c[4];
+		makeColor(color,c);
+
+		int left = rect.getLeft() + getOffset().getX();
+		int right = rect.getRight() + getOffset().getX();
+		int top = rect.getTop() + getOffset().getY();
+		int bottom = rect.getBottom() + getOffset().getY();
+
+		if(top < clipArea.getTop())
+		{
+			top = clipArea.getTop();
+		}
+		if(bottom > clipArea.getBottom())
+		{
+			bottom = clipArea.getBottom();
+		}
+
+		for(int y = top; y < bottom; ++y)
+		{
+			blendSpan(left,right,y,c);
+		}
+	}
+
+	void SoftwareGraphics::drawPixel( const Point &point,
+												const Color &color )
+	{
+		flushSprites();
+
+		unsigned char c[4];
+		makeColor(color,c);
+		blendPixel(point.getX() + getOffset().getX(),
+			point.getY() + getOffset().getY(),c);
+	}
+
+	void SoftwareGraphics::drawCircle( const Point &center,
+												 float radius, 
+												 const Color &color )
+	{
+		flushSprites();
+
+		unsigned char c[4];
+		makeColor(color,c);
+
+		int cx = center.getX() + getOffset().getX();
+		int cy = center.getY() + getOffset().getY();
+		int r = int(radius + 0.5f);
+
+		//midpoint circle, one octant mirrored eight ways
+		int x = r;
+		int y = 0;
+		int error = 1 - r;
+		while(x >= y)
+		{
+			blendPixel(cx + x,cy + y,c);
+			blendPixel(cx + y,cy + x,c);
+			blendPixel(cx - y,cy + x,c);
+			blendPixel(cx - x,cy + y,c);
+			if(y != 0)
+			{
+				blendPixel(cx - x,cy - y,c);
+				blendPixel(cx - y,cy - x,c);
+				blendPixel(cx + y,cy - x,c);
+				blendPixel(cx + x,cy - y,c);
+			}
+
+			y++;
+			if(error < 0)
+			{
+				error += 2 * y + 1;
+			}
+			else
+			{
+				x--;
+				error += 2 * (y - x) + 1;
+			}
+		}
+	}
+
+	void SoftwareGraphics::drawFilledCircle( const Point &center,
+													   float radius,
+													   const Color &color )
+	{
+		flushSprites();
+
+		unsigned char c[4];
+		makeColor(color,c);
+
+		int cx = center.getX() + getOffset().getX();
+		int cy = center.getY() + getOffset().getY();
+		int r = int(radius + 0.5f);
+
+		for(int dy = -r; dy <= r; ++dy)
+		{
+			int half = int(sqrt(float(r * r - dy * dy)) + 0.5f);
+			blendSpan(cx - half,cx + half + 1,cy + dy,c);
+		}
+	}
+
+	void SoftwareGraphics::drawLine( const Point &start,
+											   const Point &end,
+											   const Color &color)
+	{
+		flushSprites();
+
+		unsigned char c[4];
+		makeColor(color,c);
+
+		int x0 = start.getX() + getOffset().getX();
+		int y0 = start.getY() + getOffset().getY();
+		int x1 = end.getX() + getOffset().getX();
+		int y1 = end.getY() + getOffset().getY();
+
+		int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+		int dy = y1 > y0 ? y0 - y1 : y1 - y0;
+		int stepX = x0 < x1 ? 1 : -1;
+		int stepY = y0 < y1 ? 1 : -1;
+		int error = dx + dy;
+
+		while(true)
+		{
+			blendPixel(x0,y0,c);
+			if(x0 == x1 && y0 == y1)
+			{
+				break;
+			}
+
+			int error2 = 2 * error;
+			if(error2 >= dy)
+			{
+				error += dy;
+				x0 += stepX;
+			}
+			if(error2 <= dx)
+			{
+				error += dx;
+				y0 += stepY;
+			}
+		}
+	}
+
+	void SoftwareGraphics::setTargetImage( const Image *target )
+	{
+		flushSprites();
+		this->target = (SoftwareImage*)target;
+		resetClipArea();
+	}
+
+	void SoftwareGraphics::resetTargetImage()
+	{
+		flushSprites();
+		target = &display;
+		resetClipArea();
+	}
+
+	Dimension SoftwareGraphics::getDisplaySize()
+	{
+		return Dimension(display.getWidth(),display.getHeight());
+	}
+
+	void SoftwareGraphics::setDisplaySize( int width, int height )
+	{
+		flushSprites();
+		display.create(width,height);
+		if(target == &display)
+		{
+			resetClipArea();
+		}
+	}
+
+	SoftwareImage& SoftwareGraphics::getDisplay()
+	{
+		flushSprites();
+		return display;
+	}
+
+	void SoftwareGraphics::clear( const Color &color )
+	{
+		flushSprites();
+		target->clear(color);
+	}
+
+	void SoftwareGraphics::flush()
+	{
+		flushSprites();
+	}
+
+	void SoftwareGraphics::_beginPaint()
+	{
+		//stub
+	}
+
+	void SoftwareGraphics::_endPaint()
+	{
+		//stub
+	}
+}
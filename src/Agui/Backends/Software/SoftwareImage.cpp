@@ -0,0 +1,342 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/Backends/Software/SoftwareImage.hpp"
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+namespace agui
+{
+	static std::string readHeaderToken(std::istream &stream)
+	{
+		std::string token;
+		char c = 0;
+		while(stream.get(c))
+		{
+			if(c == '#')
+			{
+				//comments run to the end of the line
+				while(stream.get(c) && c != '\n')
+				{
+				}
+				continue;
+			}
+
+			if(c == ' ' || c == '\t' || c == '\r' || c == '\n')
+			{
+				if(!token.empty())
+				{
+					break;
+				}
+				continue;
+			}
+
+			token += c;
+		}
+
+		return token;
+	}
+
+	static int readHeaderInt(std::istream &stream)
+	{
+		std::istringstream value(readHeaderToken(stream));
+		int result = -1;
+		value >> result;
+		return result;
+	}
+
+	SoftwareImage::SoftwareImage(void)
+	: width(0), height(0), page(NULL), pageX(0), pageY(0)
+	{
+	}
+
+	SoftwareImage::SoftwareImage( int width, int height )
+	: width(0), height(0), page(NULL), pageX(0), pageY(0)
+	{
+		create(width,height);
+	}
+
+	SoftwareImage::SoftwareImage( const std::string& fileName, bool convertMask /*= false*/ )
+	: width(0), height(0), page(NULL), pageX(0), pageY(0)
+	{
+		std::ifstream file(fileName.c_str(),std::ios::in | std::ios::binary);
+		if(!file)
+		{
+			throw Exception("Agui Software Failed to load image " + fileName);
+		}
+
+		std::string magic = readHeaderToken(file);
+		int w = -1;
+		int h = -1;
+		int depth = 3;
+		int maxValue = -1;
+
+		if(magic == "P6")
+		{
+			w = readHeaderInt(file);
+			h = readHeaderInt(file);
+			maxValue = readHeaderInt(file);
+		}
+		else if(magic == "P7")
+		{
+			std::string token = readHeaderToken(file);
+			while(!token.empty() && token != "ENDHDR")
+			{
+				if(token == "WIDTH")
+				{
+					w = readHeaderInt(file);
+				}
+				else if(token == "HEIGHT")
+				{
+					h = readHeaderInt(file);
+				}
+				else if(token == "DEPTH")
+				{
+					depth = readHeaderInt(file);
+				}
+				else if(token == "MAXVAL")
+				{
+					maxValue = readHeaderInt(file);
+				}
+				else if(token == "TUPLTYPE")
+				{
+					readHeaderToken(file);
+				}
+
+				token = readHeaderToken(file);
+			}
+		}
+
+		if(w <= 0 || h <= 0 || maxValue != 255 || (depth != 3 && depth != 4))
+		{
+			throw Exception("Agui Software Failed to load image " + fileName);
+		}
+
+		std::vector<unsigned char> row(w * depth);
+		create(w,h);
+		for(int y = 0; y < h; ++y)
+		{
+			if(!file.read((char*)&row[0],row.size()))
+			{
+				throw Exception("Agui Software Failed to load image " + fileName);
+			}
+
+			unsigned char* dst = &pixels[y * w * 4];
+			for(int x = 0; x < w; ++x)
+			{
+				const unsigned char* src = &row[x * depth];
+				dst[0] = src[0];
+				dst[1] = src[1];
+				dst[2] = src[2];
+				dst[3] = depth == 4 ? src[3] : 255;
+
+				if(convertMask && dst[0] == 255 && dst[1] == 0 && dst[2] == 255)
+				{
+					dst[0] = dst[1] = dst[2] = dst[3] = 0;
+				}
+				dst += 4;
+			}
+		}
+	}
+
+	SoftwareImage::~SoftwareImage(void)
+	{
+	}
+
+	void SoftwareImage::create( int width, int height )
+	{
+		unlock();
+		if(width < 0)
+		{
+			width = 0;
+		}
+		if(height < 0)
+		{
+			height = 0;
+		}
+
+		this->width = width;
+		this->height = height;
+		page = NULL;
+		pageX = 0;
+		pageY = 0;
+		pixels.assign(width * height * 4,0);
+	}
+
+	int SoftwareImage::getWidth() const
+	{
+		return width;
+	}
+
+	int SoftwareImage::getHeight() const
+	{
+		return height;
+	}
+
+	bool SoftwareImage::lockRegion( const Rectangle &region,
+		PixelLockEnum mode, PixelSpan &pixels )
+	{
+		//the span points at the pixels, so every mode reads and writes them
+		(void)mode;
+		unsigned char* data = getData();
+		if(!data)
+		{
+			return false;
+		}
+
+		pixels = PixelSpan(data + region.getY() * getPitch() + region.getX() * 4,
+			getPitch(),PIXEL_FORMAT_RGBA_8888,
+			region.getWidth(),region.getHeight());
+		return true;
+	}
+
+	void SoftwareImage::unlockRegion()
+	{
+		//the span points at the pixels, nothing to write back
+	}
+
+	void SoftwareImage::clear( const Color &color )
+	{
+		PixelSpan(getData(),getPitch(),PIXEL_FORMAT_RGBA_8888,
+			width,height).fill(color);
+	}
+
+	bool SoftwareImage::isAutoFreeing() const
+	{
+		return true;
+	}
+
+	void SoftwareImage::free()
+	{
+		create(0,0);
+	}
+
+	unsigned char* SoftwareImage::getData()
+	{
+		if(page)
+		{
+			return page->getData() + pageY * page->getPitch() + pageX * 4;
+		}
+
+		return pixels.empty() ? NULL : &pixels[0];
+	}
+
+	const unsigned char* SoftwareImage::getData() const
+	{
+		if(page)
+		{
+			return page->getData() + pageY * page->getPitch() + pageX * 4;
+		}
+
+		return pixels.empty() ? NULL : &pixels[0];
+	}
+
+	int SoftwareImage::getPitch() const
+	{
+		return page ? page->getPitch() : width * 4;
+	}
+
+	void SoftwareImage::_setAtlasPage( SoftwareImage* page, int x, int y )
+	{
+		unlock();
+		for(int row = 0; row < height; ++row)
+		{
+			memcpy(page->getData() + (y + row) * page->getPitch() + x * 4,
+				getData() + row * getPitch(),width * 4);
+		}
+
+		std::vector<unsigned char>().swap(pixels);
+		this->page = page;
+		pageX = x;
+		pageY = y;
+	}
+
+	const SoftwareImage* SoftwareImage::getTexture() const
+	{
+		return page ? page : this;
+	}
+
+	int SoftwareImage::getTextureX() const
+	{
+		return pageX;
+	}
+
+	int SoftwareImage::getTextureY() const
+	{
+		return pageY;
+	}
+
+	bool SoftwareImage::hasSamePixels( const SoftwareImage &image ) const
+	{
+		if(width != image.width || height != image.height)
+		{
+			return false;
+		}
+
+		for(int y = 0; y < height; ++y)
+		{
+			if(memcmp(getData() + y * getPitch(),
+				image.getData() + y * image.getPitch(),width * 4) != 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void SoftwareImage::save( const std::string& fileName ) const
+	{
+		std::ofstream file(fileName.c_str(),std::ios::out | std::ios::binary);
+		if(!file)
+		{
+			throw Exception("Agui Software Failed to save image " + fileName);
+		}
+
+		file << "P7\nWIDTH " << width << "\nHEIGHT " << height <<
+			"\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n";
+		for(int y = 0; y < height; ++y)
+		{
+			file.write((const char*)(getData() + y * getPitch()),width * 4);
+		}
+	}
+
+}
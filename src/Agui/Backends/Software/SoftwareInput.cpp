@@ -0,0 +1,148 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/Backends/Software/SoftwareInput.hpp"
+
+namespace agui
+{
+
+	SoftwareInput::SoftwareInput(void)
+		: time(0.0)
+	{
+	}
+
+	SoftwareInput::~SoftwareInput(void)
+	{
+	}
+
+	double SoftwareInput::getTime() const
+	{
+		return time;
+	}
+
+	void SoftwareInput::setTime( double time )
+	{
+		this->time = time;
+	}
+
+	void SoftwareInput::advanceTime( double seconds )
+	{
+		time += seconds;
+	}
+
+	void SoftwareInput::pollInput()
+	{
+		while(!mouseScript.empty() && mouseScript.front().first <= time)
+		{
+			if(isMouseEnabled())
+			{
+				pushMouseEvent(mouseScript.front().second);
+			}
+			mouseScript.pop_front();
+		}
+
+		while(!keyboardScript.empty() && keyboardScript.front().first <= time)
+		{
+			if(isKeyboardEnabled())
+			{
+				pushKeyboardEvent(keyboardScript.front().second);
+			}
+			keyboardScript.pop_front();
+		}
+	}
+
+	void SoftwareInput::scheduleMouseInput( double time, const MouseInput &input )
+	{
+		std::deque<std::pair<double,MouseInput> >::iterator it = mouseScript.end();
+		while(it != mouseScript.begin() && (it - 1)->first > time)
+		{
+			--it;
+		}
+
+		mouseScript.insert(it,std::make_pair(time,input));
+	}
+
+	void SoftwareInput::scheduleKeyboardInput( double time, const KeyboardInput &input )
+	{
+		std::deque<std::pair<double,KeyboardInput> >::iterator it = keyboardScript.end();
+		while(it != keyboardScript.begin() && (it - 1)->first > time)
+		{
+			--it;
+		}
+
+		keyboardScript.insert(it,std::make_pair(time,input));
+	}
+
+	void SoftwareInput::scheduleMouseMove( double time, int x, int y )
+	{
+		scheduleMouseInput(time,MouseInput(MouseEvent::MOUSE_MOVE,
+			MOUSE_BUTTON_NONE,x,y,0,0.0f,time,false,false,false));
+	}
+
+	void SoftwareInput::scheduleMouseClick( double time, int x, int y, 
+		MouseButtonEnum button /*= MOUSE_BUTTON_LEFT*/ )
+	{
+		scheduleMouseInput(time,MouseInput(MouseEvent::MOUSE_DOWN,
+			button,x,y,0,0.0f,time,false,false,false));
+		scheduleMouseInput(time,MouseInput(MouseEvent::MOUSE_UP,
+			button,x,y,0,0.0f,time,false,false,false));
+	}
+
+	void SoftwareInput::scheduleKeyPress( double time, KeyEnum key,
+		unsigned int unichar, ExtendedKeyEnum extKey /*= EXT_KEY_NONE*/ )
+	{
+		scheduleKeyboardInput(time,KeyboardInput(KeyEvent::KEY_DOWN,
+			key,extKey,unichar,time,false,false,false,false));
+		scheduleKeyboardInput(time,KeyboardInput(KeyEvent::KEY_UP,
+			key,extKey,unichar,time,false,false,false,false));
+	}
+
+	bool SoftwareInput::isScriptFinished() const
+	{
+		return mouseScript.empty() && keyboardScript.empty();
+	}
+
+	void SoftwareInput::clearScript()
+	{
+		mouseScript.clear();
+		keyboardScript.clear();
+	}
+
+}
@@ -52,18 +52,21 @@ namespace agui
 	{
 	}
 
-	void BlinkingEvent::processBlinkEvent( double elapsedTime )
+	bool BlinkingEvent::processBlinkEvent( double elapsedTime )
 	{
 		if(elapsedTime > lastBlinkTime)
 		{
 			blinking = !blinking;
 			lastBlinkTime = elapsedTime + blinkInterval;
+			return true;
 		}
 		else if(blinkNeedsInvalidation)
 		{
 			lastBlinkTime = elapsedTime + blinkInterval;
 			blinkNeedsInvalidation = false;
 		}
+
+		return false;
 	}
 
 	bool BlinkingEvent::isBlinking() const
@@ -0,0 +1,525 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/DrawCommandList.hpp"
+#include "Agui/Font.hpp"
+#include <climits>
+
+namespace agui
+{
+	DrawCommandList::DrawCommandList()
+	: graphics(NULL), clipChanged(false), recordedClipKnown(false),
+	mergedCount(0), culledCount(0), clipRequestCount(0),
+	clipCommandCount(0), drawCallCount(0), stateChangeCount(0)
+	{
+	}
+
+	DrawCommandList::~DrawCommandList()
+	{
+	}
+
+	void DrawCommandList::setGraphics( Graphics* graphics )
+	{
+		this->graphics = graphics;
+	}
+
+	Graphics* DrawCommandList::getGraphics() const
+	{
+		return graphics;
+	}
+
+	void DrawCommandList::clear()
+	{
+		commands.clear();
+		textArena.clear();
+		clipChanged = false;
+		recordedClipKnown = false;
+		mergedCount = 0;
+		culledCount = 0;
+		clipRequestCount = 0;
+		clipCommandCount = 0;
+	}
+
+	bool DrawCommandList::isEmpty() const
+	{
+		return commands.empty();
+	}
+
+	int DrawCommandList::getCommandCount() const
+	{
+		return int(commands.size());
+	}
+
+	int DrawCommandList::getMergedCount() const
+	{
+		return mergedCount;
+	}
+
+	int DrawCommandList::getCulledCount() const
+	{
+		return culledCount;
+	}
+
+	int DrawCommandList::getSkippedStateChangeCount() const
+	{
+		return clipRequestCount - clipCommandCount;
+	}
+
+	int DrawCommandList::getDrawCallCount() const
+	{
+		return drawCallCount;
+	}
+
+	int DrawCommandList::getStateChangeCount() const
+	{
+		return stateChangeCount;
+	}
+
+	bool DrawCommandList::isSameRectangle( const Rectangle &a, const Rectangle &b ) const
+	{
+		return a.getX() == b.getX() && a.getY() == b.getY() &&
+			a.getWidth() == b.getWidth() && a.getHeight() == b.getHeight();
+	}
+
+	DrawCommandList::DrawCommand& DrawCommandList::addCommand( DrawCommandTypeEnum type )
+	{
+		commands.push_back(DrawCommand());
+		DrawCommand &c = commands.back();
+		c.type = type;
+		c.x = 0;
+		c.y = 0;
+		c.width = 0;
+		c.height = 0;
+		c.regionX = 0;
+		c.regionY = 0;
+		c.regionWidth = 0;
+		c.regionHeight = 0;
+		c.value = 0.0f;
+		c.image = NULL;
+		c.font = NULL;
+		c.textStart = 0;
+		c.align = ALIGN_LEFT;
+		return c;
+	}
+
+	bool DrawCommandList::beginDraw( int left, int top, int right, int bottom )
+	{
+		//the clipping rectangle the operation would be drawn with
+		if(clipChanged || recordedClipKnown)
+		{
+			const Rectangle &r = clipChanged ? clip : recordedClip;
+			if(right <= r.getLeft() || left >= r.getRight() ||
+				bottom <= r.getTop() || top >= r.getBottom())
+			{
+				culledCount++;
+				return false;
+			}
+		}
+
+		//only the last clipping change before an operation is needed
+		if(clipChanged)
+		{
+			clipChanged = false;
+			if(!recordedClipKnown || !isSameRectangle(clip,recordedClip))
+			{
+				DrawCommand &c = addCommand(CLIP);
+				c.x = clip.getX();
+				c.y = clip.getY();
+				c.width = clip.getWidth();
+				c.height = clip.getHeight();
+				recordedClip = clip;
+				recordedClipKnown = true;
+				clipCommandCount++;
+			}
+		}
+
+		return true;
+	}
+
+	void DrawCommandList::setClippingRectangle( const Rectangle &rect )
+	{
+		clip = rect;
+		clipChanged = true;
+		clipRequestCount++;
+	}
+
+	Rectangle DrawCommandList::getClippingRectangle()
+	{
+		return clip;
+	}
+
+	Dimension DrawCommandList::getDisplaySize()
+	{
+		if(graphics)
+		{
+			return graphics->getDisplaySize();
+		}
+
+		return Dimension();
+	}
+
+	void DrawCommandList::_beginPaint()
+	{
+	}
+
+	void DrawCommandList::_endPaint()
+	{
+	}
+
+	void DrawCommandList::drawImage( const Image *bmp, const Point &position,
+		const Point &regionStart, const Dimension &regionSize,
+		const float &opacity /*= 1.0f*/ )
+	{
+		int x = position.getX() + getOffset().getX();
+		int y = position.getY() + getOffset().getY();
+		if(!beginDraw(x,y,x + regionSize.getWidth(),y + regionSize.getHeight()))
+		{
+			return;
+		}
+
+		DrawCommand &c = addCommand(IMAGE);
+		c.x = x;
+		c.y = y;
+		c.regionX = regionStart.getX();
+		c.regionY = regionStart.getY();
+		c.regionWidth = regionSize.getWidth();
+		c.regionHeight = regionSize.getHeight();
+		c.value = opacity;
+		c.image = bmp;
+	}
+
+	void DrawCommandList::drawImage( const Image *bmp, const Point &position,
+		const float &opacity /*= 1.0f*/ )
+	{
+		int x = position.getX() + getOffset().getX();
+		int y = position.getY() + getOffset().getY();
+		if(!beginDraw(x,y,x + bmp->getWidth(),y + bmp->getHeight()))
+		{
+			return;
+		}
+
+		//a negative region width means the whole image
+		DrawCommand &c = addCommand(IMAGE);
+		c.x = x;
+		c.y = y;
+		c.regionWidth = -1;
+		c.value = opacity;
+		c.image = bmp;
+	}
+
+	void DrawCommandList::drawScaledImage( const Image *bmp, const Point &position,
+		const Point &regionStart, const Dimension &regionScale,
+		const Dimension &scale, const float &opacity /*= 1.0f*/ )
+	{
+		int x = position.getX() + getOffset().getX();
+		int y = position.getY() + getOffset().getY();
+		if(!beginDraw(x,y,x + scale.getWidth(),y + scale.getHeight()))
+		{
+			return;
+		}
+
+		DrawCommand &c = addCommand(SCALED_IMAGE);
+		c.x = x;
+		c.y = y;
+		c.width = scale.getWidth();
+		c.height = scale.getHeight();
+		c.regionX = regionStart.getX();
+		c.regionY = regionStart.getY();
+		c.regionWidth = regionScale.getWidth();
+		c.regionHeight = regionScale.getHeight();
+		c.value = opacity;
+		c.image = bmp;
+	}
+
+	void DrawCommandList::drawText( const Point &position, const char* text,
+		const Color &color, const Font *font, AlignmentEnum align /*= ALIGN_LEFT*/ )
+	{
+		int x = position.getX() + getOffset().getX();
+		int y = position.getY() + getOffset().getY();
+
+		//the width is not measured, only the side it grows to is known
+		int left = align == ALIGN_LEFT ? x : INT_MIN;
+		int right = align == ALIGN_RIGHT ? x : INT_MAX;
+		if(!beginDraw(left,y,right,y + font->getLineHeight()))
+		{
+			return;
+		}
+
+		DrawCommand &c = addCommand(TEXT);
+		c.x = x;
+		c.y = y;
+		c.color = color;
+		c.font = font;
+		c.align = align;
+		c.textStart = textArena.length();
+		textArena += text;
+		textArena += '\0';
+	}
+
+	void DrawCommandList::drawRectangle( const Rectangle &rect, const Color &color )
+	{
+		int x = rect.getX() + getOffset().getX();
+		int y = rect.getY() + getOffset().getY();
+		if(!beginDraw(x - 1,y - 1,x + rect.getWidth() + 1,y + rect.getHeight() + 1))
+		{
+			return;
+		}
+
+		DrawCommand &c = addCommand(RECTANGLE);
+		c.x = x;
+		c.y = y;
+		c.width = rect.getWidth();
+		c.height = rect.getHeight();
+		c.color = color;
+	}
+
+	void DrawCommandList::drawFilledRectangle( const Rectangle &rect, const Color &color )
+	{
+		int x = rect.getX() + getOffset().getX();
+		int y = rect.getY() + getOffset().getY();
+		if(!beginDraw(x,y,x + rect.getWidth(),y + rect.getHeight()))
+		{
+			return;
+		}
+
+		//a rectangle that shares a whole edge with the previous one
+		//covers the same pixels as both of them
+		if(!commands.empty() && commands.back().type == FILLED_RECTANGLE &&
+			rect.getWidth() > 0 && rect.getHeight() > 0)
+		{
+			DrawCommand &last = commands.back();
+			if(last.color.getR() == color.getR() && last.color.getG() == color.getG() &&
+				last.color.getB() == color.getB() && last.color.getA() == color.getA())
+			{
+				if(last.y == y && last.height == rect.getHeight() &&
+					(last.x + last.width == x || x + rect.getWidth() == last.x))
+				{
+					last.x = x < last.x ? x : last.x;
+					last.width += rect.getWidth();
+					mergedCount++;
+					return;
+				}
+
+				if(last.x == x && last.width == rect.getWidth() &&
+					(last.y + last.height == y || y + rect.getHeight() == last.y))
+				{
+					last.y = y < last.y ? y : last.y;
+					last.height += rect.getHeight();
+					mergedCount++;
+					return;
+				}
+			}
+		}
+
+		DrawCommand &c = addCommand(FILLED_RECTANGLE);
+		c.x = x;
+		c.y = y;
+		c.width = rect.getWidth();
+		c.height = rect.getHeight();
+		c.color = color;
+	}
+
+	void DrawCommandList::drawCircle( const Point &center, float radius, const Color &color )
+	{
+		int x = center.getX() + getOffset().getX();
+		int y = center.getY() + getOffset().getY();
+		int r = int(radius) + 2;
+		if(!beginDraw(x - r,y - r,x + r,y + r))
+		{
+			return;
+		}
+
+		DrawCommand &c = addCommand(CIRCLE);
+		c.x = x;
+		c.y = y;
+		c.value = radius;
+		c.color = color;
+	}
+
+	void DrawCommandList::drawFilledCircle( const Point &center, float radius, const Color &color )
+	{
+		int x = center.getX() + getOffset().getX();
+		int y = center.getY() + getOffset().getY();
+		int r = int(radius) + 2;
+		if(!beginDraw(x - r,y - r,x + r,y + r))
+		{
+			return;
+		}
+
+		DrawCommand &c = addCommand(FILLED_CIRCLE);
+		c.x = x;
+		c.y = y;
+		c.value = radius;
+		c.color = color;
+	}
+
+	void DrawCommandList::drawPixel( const Point &point, const Color &color )
+	{
+		int x = point.getX() + getOffset().getX();
+		int y = point.getY() + getOffset().getY();
+		if(!beginDraw(x - 1,y - 1,x + 2,y + 2))
+		{
+			return;
+		}
+
+		DrawCommand &c = addCommand(PIXEL);
+		c.x = x;
+		c.y = y;
+		c.color = color;
+	}
+
+	void DrawCommandList::drawLine( const Point &start, const Point &end, const Color &color )
+	{
+		int x1 = start.getX() + getOffset().getX();
+		int y1 = start.getY() + getOffset().getY();
+		int x2 = end.getX() + getOffset().getX();
+		int y2 = end.getY() + getOffset().getY();
+		if(!beginDraw((x1 < x2 ? x1 : x2) - 1,(y1 < y2 ? y1 : y2) - 1,
+			(x1 > x2 ? x1 : x2) + 2,(y1 > y2 ? y1 : y2) + 2))
+		{
+			return;
+		}
+
+		DrawCommand &c = addCommand(LINE);
+		c.x = x1;
+		c.y = y1;
+		c.width = x2;
+		c.height = y2;
+		c.color = color;
+	}
+
+	void DrawCommandList::setTargetImage( const Image *target )
+	{
+		DrawCommand &c = addCommand(SET_TARGET);
+		c.image = target;
+
+		//the clipping rectangle of the Graphics is unknown after this
+		recordedClipKnown = false;
+		clipChanged = false;
+	}
+
+	void DrawCommandList::resetTargetImage()
+	{
+		addCommand(RESET_TARGET);
+		recordedClipKnown = false;
+		clipChanged = false;
+	}
+
+	void DrawCommandList::submit()
+	{
+		drawCallCount = 0;
+		stateChangeCount = 0;
+
+		if(!graphics)
+		{
+			return;
+		}
+
+		graphics->setOffset(Point(0,0));
+
+		for(std::vector<DrawCommand>::const_iterator it = commands.begin();
+			it != commands.end(); ++it)
+		{
+			const DrawCommand &c = *it;
+			switch(c.type)
+			{
+			case CLIP:
+				while(!submitStack.empty())
+				{
+					submitStack.pop();
+				}
+				submitStack.push(Rectangle(c.x,c.y,c.width,c.height));
+				graphics->setClippingStack(submitStack,Point(0,0));
+				stateChangeCount++;
+				continue;
+			case SET_TARGET:
+				graphics->setTargetImage(c.image);
+				stateChangeCount++;
+				continue;
+			case RESET_TARGET:
+				graphics->resetTargetImage();
+				stateChangeCount++;
+				continue;
+			case IMAGE:
+				if(c.regionWidth < 0)
+				{
+					graphics->drawImage(c.image,Point(c.x,c.y),c.value);
+				}
+				else
+				{
+					graphics->drawImage(c.image,Point(c.x,c.y),
+						Point(c.regionX,c.regionY),
+						Dimension(c.regionWidth,c.regionHeight),c.value);
+				}
+				break;
+			case SCALED_IMAGE:
+				graphics->drawScaledImage(c.image,Point(c.x,c.y),
+					Point(c.regionX,c.regionY),
+					Dimension(c.regionWidth,c.regionHeight),
+					Dimension(c.width,c.height),c.value);
+				break;
+			case TEXT:
+				graphics->drawText(Point(c.x,c.y),&textArena[c.textStart],
+					c.color,c.font,c.align);
+				break;
+			case RECTANGLE:
+				graphics->drawRectangle(Rectangle(c.x,c.y,c.width,c.height),c.color);
+				break;
+			case FILLED_RECTANGLE:
+				graphics->drawFilledRectangle(Rectangle(c.x,c.y,c.width,c.height),c.color);
+				break;
+			case CIRCLE:
+				graphics->drawCircle(Point(c.x,c.y),c.value,c.color);
+				break;
+			case FILLED_CIRCLE:
+				graphics->drawFilledCircle(Point(c.x,c.y),c.value,c.color);
+				break;
+			case PIXEL:
+				graphics->drawPixel(Point(c.x,c.y),c.color);
+				break;
+			case LINE:
+				graphics->drawLine(Point(c.x,c.y),Point(c.width,c.height),c.color);
+				break;
+			}
+
+			drawCallCount++;
+		}
+	}
+}
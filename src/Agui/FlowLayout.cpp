@@ -85,11 +85,6 @@ namespace agui
 					firstWidget = (*it);
 				}
 
-				if(isResizingRowToWidth())
-				{
-					(*it)->setSize(getInnerWidth(),(*it)->getHeight());
-				}
-
 				if((maxOnRow > 0 && numOnRow >= maxOnRow) || isResizingRowToWidth() ||
 					(curX + (*it)->getWidth() > getInnerWidth() && numWidgets > 0 && !singleRow))
 				{
@@ -186,6 +181,25 @@ namespace agui
 			contentHSz = lowestPoint + getMargin(SIDE_TOP) + getMargin(SIDE_BOTTOM);
 	}
 
+	void FlowLayout::sizeChildren()
+	{
+		if(!isResizingRowToWidth())
+		{
+			return;
+		}
+
+		for(WidgetArray::iterator it = getChildBegin(); 
+			it != getChildEnd(); ++it)
+		{
+			if(!(*it)->isVisible() && isFilteringVisibility())
+			{
+				continue;
+			}
+
+			(*it)->setSize(getInnerWidth(),(*it)->getHeight());
+		}
+	}
+
 	void FlowLayout::setHorizontalSpacing( int spacing )
 	{
 		horizontalSpacing = spacing;
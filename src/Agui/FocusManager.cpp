@@ -89,14 +89,20 @@ bool FocusManager::widgetIsModalChild( Widget* widget )
 
 		if(focusedWidget)
 			if(focusedWidget != widget)
+			{
+				focusedWidget->invalidate();
 				focusedWidget->focusLost();
+			}
 
 		focusedWidget = widget;
 
 		if(widget)
 			if(widget->isFocusable() && widget->isVisible() 
 				&& widget->isEnabled())
+			{
+				widget->invalidate();
 				widget->focusGained();
+			}
 	}
 
 	bool FocusManager::requestModalFocus( Widget* widget )
@@ -40,6 +40,7 @@
 
 #include "Agui/Font.hpp"
 #include "Agui/FontLoader.hpp"
+#include <algorithm>
 namespace agui
 {
 	FontLoader* Font::loader = NULL;
@@ -59,30 +60,126 @@ namespace agui
 		loader = manager;
 	}
 
+	int Font::measureGlyph( int unichar ) const
+	{
+		char buffer[8];
+		for(int i = 0; i < 8; ++i)
+		{
+			buffer[i] = 0;
+		}
+
+		unicodeFunctions.encodeUtf8(buffer,unichar);
+		return getTextWidth(buffer);
+	}
+
+	int Font::getGlyphAdvance( int unichar ) const
+	{
+		//most text is ASCII so those get a flat table
+		if(unichar >= 0 && unichar < 128)
+		{
+			if(asciiAdvances.empty())
+			{
+				asciiAdvances.resize(128,-1);
+			}
+			if(asciiAdvances[unichar] < 0)
+			{
+				asciiAdvances[unichar] = measureGlyph(unichar);
+			}
+			return asciiAdvances[unichar];
+		}
+
+		std::map<int,int>::const_iterator it = glyphAdvances.find(unichar);
+		if(it != glyphAdvances.end())
+		{
+			return it->second;
+		}
+
+		int advance = measureGlyph(unichar);
+		glyphAdvances[unichar] = advance;
+		return advance;
+	}
+
+	int Font::getTextAdvance( const std::string &text ) const
+	{
+		int width = 0;
+		size_t index = 0;
+		size_t start = 0;
+		size_t len = 0;
+
+		while(index < text.length())
+		{
+			start = index;
+			len = unicodeFunctions.bringToNextUnichar(index,text);
+			width += getGlyphAdvance(unicodeFunctions.decodeUtf8(&text[start],len));
+		}
+
+		return width;
+	}
+
+	void Font::getPrefixWidths( const std::string &text, std::vector<int> &widths ) const
+	{
+		widths.clear();
+		appendPrefixWidths(text.c_str(),text.length(),widths);
+	}
+
+	void Font::appendPrefixWidths( const char* text, size_t bytes,
+		std::vector<int> &widths ) const
+	{
+		if(widths.empty())
+		{
+			widths.push_back(0);
+		}
+
+		const char* it = text;
+		const char* last = text + bytes;
+		const char* start = it;
+		size_t len = 0;
+
+		while(it != last)
+		{
+			start = it;
+			len = unicodeFunctions.bringToNextUnichar(it,last);
+			widths.push_back(widths.back() +
+				getGlyphAdvance(unicodeFunctions.decodeUtf8(start,len)));
+		}
+	}
+
+	void Font::clearGlyphCache()
+	{
+		asciiAdvances.clear();
+		glyphAdvances.clear();
+	}
+
 	int Font::getStringIndexFromPosition( const std::string &str, int x ) const
 	{
-		UTF8 utf8;
+		if(x < 0)
+		{
+			return 0;
+		}
 
-		unsigned int i;
+		int i = 0;
 		int size = 0;
+		int cmpsize = 0;
+		size_t index = 0;
+		size_t start = 0;
+		size_t len = 0;
 
-		for (i = 0; i <= utf8.length(str); ++i)
+		//walk the advances once and stop at the glyph that x is inside of
+		while(index < str.length())
 		{
-			size = getTextWidth(utf8.subStr(str,0,i));
+			start = index;
+			len = unicodeFunctions.bringToNextUnichar(index,str);
+
+			cmpsize = size;
+			size += getGlyphAdvance(unicodeFunctions.decodeUtf8(&str[start],len));
+			i++;
 
 			if (size > x)
 			{
-				if( i == 0)
-				{
-					return i;
-				}
-				int cmpsize = getTextWidth(utf8.subStr(str,0,i - 1));
 				int diff = size - cmpsize;
 				diff /= 2;
 
-				x -= cmpsize;
-
-				if(x > diff)
+				if(x - cmpsize > diff)
 				{
 					return i;
 				}
@@ -90,11 +187,43 @@ namespace agui
 				{
 					return i - 1;
 				}
-
 			}
 		}
-		return int(utf8.length(str));
 
+		return i;
+	}
+
+	int Font::getStringIndexFromPosition( const std::vector<int> &prefixWidths, int x )
+	{
+		if(prefixWidths.empty())
+		{
+			return 0;
+		}
+
+		//the first prefix that is wider than x
+		int i = int(std::upper_bound(prefixWidths.begin(),
+			prefixWidths.end(),x) - prefixWidths.begin());
+
+		if(i == (int)prefixWidths.size())
+		{
+			return i - 1;
+		}
+		if(i == 0)
+		{
+			return 0;
+		}
+
+		int diff = prefixWidths[i] - prefixWidths[i - 1];
+		diff /= 2;
+
+		if(x - prefixWidths[i - 1] > diff)
+		{
+			return i;
+		}
+		else
+		{
+			return i - 1;
+		}
 	}
 
 	Font* Font::load( const std::string &fileName, int height, FontFlags fontFlags, float borderWidth, agui::Color borderColor )
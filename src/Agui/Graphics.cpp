@@ -50,10 +50,15 @@ namespace agui {
 
 		if(clipStack.empty())
 		{
-			clipRect = relRect;
-			clipStack.push(relRect);
-			setClippingRectangle(clipRect);
-			return;
+			if(!usingBaseClipRect)
+			{
+				clipRect = relRect;
+				clipStack.push(relRect);
+				setClippingRectangle(clipRect);
+				return;
+			}
+
+			clipRect = baseClipRect;
 		}
 
 		workingRect = clipRect; 
@@ -116,10 +121,38 @@ namespace agui {
 			
 			}
 
-			clipRect = Rectangle(Point(0,0),getDisplaySize());
+			if(usingBaseClipRect)
+			{
+				clipRect = baseClipRect;
+			}
+			else
+			{
+				clipRect = Rectangle(Point(0,0),getDisplaySize());
+			}
 			setClippingRectangle(clipRect);
 	}
 
+	void Graphics::setBaseClippingRect( const Rectangle &rect )
+	{
+		baseClipRect = rect;
+		usingBaseClipRect = true;
+	}
+
+	void Graphics::clearBaseClippingRect()
+	{
+		usingBaseClipRect = false;
+	}
+
+	bool Graphics::isUsingBaseClippingRect() const
+	{
+		return usingBaseClipRect;
+	}
+
+	const Rectangle& Graphics::getBaseClippingRect() const
+	{
+		return baseClipRect;
+	}
+
 	size_t Graphics::getClippingRectCount() const
 	{
 		return clipStack.size();
@@ -152,6 +185,10 @@ namespace agui {
 		}
 	}
 
+	void Graphics::flush()
+	{
+	}
+
 	void Graphics::drawNinePatchImage( const Image *bmp,
 												 const Point &position,
 												 const Dimension &scale, 
@@ -58,10 +58,17 @@ namespace agui
 		 maxToolTipWidth(300), hasHiddenToolTip(true),
 		 lastToolTipTime(0.0), toolTipShowLength(4.0),
 		 cursorProvider(NULL), wantWidgetLocationChanged(true),
-		 useTransform(false),delayMouseDown(true)
+		 widgetUnderMouseDirty(false),
+		 useTransform(false),delayMouseDown(true),
+		 dirtyRendering(false),paintedWidgetCount(0),
+		 paintedPixelCount(0),culledWidgetCount(0),layoutSuspendCount(0),
+		 hasDirtyLayouts(false),flushingLayouts(false),
+		 batchingDrawCommands(false),drawCommandsStale(true),
+		 globalFontID(Widget::_getGlobalFontID())
 	{
 		
 		baseWidget = new TopContainer(this,&focusMan);
+		liveWidgets.insert(baseWidget);
 
 		//initialize variables
 		widgetUnderMouse = 0;
@@ -631,13 +638,32 @@ namespace agui
 					mouse.getPosition().getY() - currentNode->getAbsolutePosition().getY())))
 					&& currentNode->isEnabled() && currentNode->isVisible()))
 				{
-					for (WidgetArray::const_reverse_iterator rit = 
-						currentNode->getChildRBegin();
-						rit != currentNode->getChildREnd(); ++rit) 
-					{ 
-						q.push(*rit);
+					if(currentNode->isChildIndexing())
+					{
+						//only the children whose rectangle contains the mouse can pass
+						currentNode->_getChildrenAt(Point(
+							mouse.getPosition().getX() - currentNode->getAbsolutePosition().getX()
+							- currentNode->getMargin(SIDE_LEFT),
+							mouse.getPosition().getY() - currentNode->getAbsolutePosition().getY()
+							- currentNode->getMargin(SIDE_TOP)),hitCandidates);
+
+						for (WidgetArray::const_reverse_iterator rit = 
+							hitCandidates.rbegin();
+							rit != hitCandidates.rend(); ++rit) 
+						{ 
+							q.push(*rit);
+						} 
+					}
+					else
+					{
+						for (WidgetArray::const_reverse_iterator rit = 
+							currentNode->getChildRBegin();
+							rit != currentNode->getChildREnd(); ++rit) 
+						{ 
+							q.push(*rit);
 
-					} 
+						} 
+					}
 
 					for (WidgetArray::const_reverse_iterator rit = 
 						currentNode->getPrivateChildRBegin();
@@ -680,6 +706,7 @@ namespace agui
 			
 			if(widgetExists(baseWidget,focusMan.getFocusedWidget()))
 			{
+				invalidateEventTarget(focusMan.getFocusedWidget());
 				focusMan.getFocusedWidget()->keyDown(keyEvent);
 			}
 
@@ -713,6 +740,7 @@ namespace agui
 
 			if(widgetExists(baseWidget,focusMan.getFocusedWidget()))
 			{
+				invalidateEventTarget(focusMan.getFocusedWidget());
 				focusMan.getFocusedWidget()->keyUp(keyEvent);
 			}
 
@@ -739,6 +767,7 @@ namespace agui
 
 			if(widgetExists(baseWidget,focusMan.getFocusedWidget()))
 			{
+				invalidateEventTarget(focusMan.getFocusedWidget());
 				focusMan.getFocusedWidget()->keyRepeat(keyEvent);
 			}
 
@@ -920,6 +949,12 @@ namespace agui
 			return true;
 		}
 
+		//the widgets in the tree are kept in a set as they are added and removed
+		if(root == baseWidget)
+		{
+			return _isWidgetRegistered(target);
+		}
+
 		if(root == target)
 		{
 			return true;
@@ -1130,6 +1165,20 @@ namespace agui
 
 	void Gui::_widgetLocationChanged()
 	{
+		if(wantWidgetLocationChanged)
+		widgetUnderMouseDirty = true;
+	}
+
+	void Gui::updateWidgetUnderMouse()
+	{
+		if(!widgetUnderMouseDirty)
+		{
+			return;
+		}
+
+		//a layout pass can move thousands of widgets,
+		//so the hit test runs once for all of them
+		widgetUnderMouseDirty = false;
 		if(wantWidgetLocationChanged)
 		handleMouseAxes(emptyMouse,true);
 	}
@@ -1146,22 +1195,23 @@ namespace agui
 			}
 		}
 
-		if(widget == widgetUnderMouse)
+		//the mouse may be over a child of the removed widget
+		if(isRemovedWith(widgetUnderMouse,widget))
 			widgetUnderMouse = NULL;
 
-		if(widget == lastMouseDownControl)
+		if(isRemovedWith(lastMouseDownControl,widget))
 			lastMouseDownControl = NULL;
 
-		if(widget == previousWidgetUnderMouse)
+		if(isRemovedWith(previousWidgetUnderMouse,widget))
 			previousWidgetUnderMouse = NULL;
 
 		if(widget == focusMan.getFocusedWidget())
       focusMan.setFocusedWidget(NULL);
 
-		if(widget == controlWithLock)
+		if(isRemovedWith(controlWithLock,widget))
 			controlWithLock = NULL;
 
-		if(widget == lastHoveredControl)
+		if(isRemovedWith(lastHoveredControl,widget))
 			lastHoveredControl = NULL;
 
 		if(widget == focusMan.getModalWidget())
@@ -1169,8 +1219,23 @@ namespace agui
 	}
 
 
+	bool Gui::isRemovedWith( const Widget *widget, const Widget *removed ) const
+	{
+		for(const Widget* w = widget; w != NULL; w = w->getParent())
+		{
+			if(w == removed)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	void Gui::makeRelArgs( Widget *source )
 	{
+		invalidateEventTarget(source);
+
 		relArgs = MouseEvent(Point(
 			mouseEvent.getX() - source->getAbsolutePosition().getX(),
 			mouseEvent.getY() - source->getAbsolutePosition().getY()),
@@ -1187,6 +1252,7 @@ namespace agui
 	{
 		input->pollInput();
 		_dispatchKeyboardEvents();
+		updateWidgetUnderMouse();
 		_dispatchMouseEvents();
 		handleTimedEvents();
 		currentTime = input->getTime();
@@ -1217,9 +1283,29 @@ namespace agui
 		}
 	}
 
+	void Gui::recursiveFlushLayouts( Widget* baseWidget )
+	{
+		baseWidget->_flushLayout();
+
+		for(WidgetArray::iterator it = 
+			baseWidget->getPrivateChildBegin();
+			it != baseWidget->getPrivateChildEnd(); ++it)
+		{
+			recursiveFlushLayouts(*it);
+		}
+
+		for(WidgetArray::iterator it = 
+			baseWidget->getChildBegin();
+			it != baseWidget->getChildEnd(); ++it)
+		{
+			recursiveFlushLayouts(*it);
+		}
+	}
+
 	void Gui::setGraphics( Graphics *context )
 	{
 		graphicsContext = context;
+		drawCommandsStale = true;
 		if(input)
 		{
 			baseWidget->setSize(graphicsContext->getDisplaySize());
@@ -1243,9 +1329,80 @@ namespace agui
 
 	void Gui::render()
 	{
-		graphicsContext->clearClippingStack();
+		//the widgets take a new global font before anything is painted
+		if(globalFontID != Widget::_getGlobalFontID())
+		{
+			globalFontID = Widget::_getGlobalFontID();
+			baseWidget->_applyGlobalFont();
+		}
+
+		flushLayouts();
+
+		paintedWidgetCount = 0;
+		paintedPixelCount = 0;
+		culledWidgetCount = 0;
+
+		if(dirtyRendering && damagedRects.empty())
+		{
+			return;
+		}
+
+		Graphics* context = graphicsContext;
+		if(batchingDrawCommands)
+		{
+			drawCommands.setGraphics(graphicsContext);
+
+			//nothing changed since the commands were recorded
+			if(!dirtyRendering && !drawCommandsStale && !drawCommands.isEmpty())
+			{
+				drawCommands.submit();
+				paintedPixelCount = baseWidget->getWidth() * baseWidget->getHeight();
+				graphicsContext->flush();
+				graphicsContext->clearClippingStack();
+				graphicsContext->setOffset(Point(0,0));
+				graphicsContext->pushClippingRect(Rectangle(Point(0,0),baseWidget->getSize()));
+				return;
+			}
+
+			drawCommands.clear();
+			drawCommandsStale = false;
+			context = &drawCommands;
+		}
 
-		baseWidget->_recursivePaintChildren(baseWidget,true,graphicsContext);
+		if(!dirtyRendering)
+		{
+			context->clearClippingStack();
+
+			baseWidget->_recursivePaintChildren(baseWidget,true,context);
+			paintedPixelCount = baseWidget->getWidth() * baseWidget->getHeight();
+		}
+		else
+		{
+			//damage added while painting is kept for the next frame
+			std::vector<Rectangle> damage;
+			damage.swap(damagedRects);
+
+			for(std::vector<Rectangle>::iterator it = damage.begin();
+				it != damage.end(); ++it)
+			{
+				context->setBaseClippingRect(*it);
+				context->clearClippingStack();
+				context->setOffset(Point(0,0));
+				context->drawFilledRectangle(*it,baseWidget->getBackColor());
+
+				baseWidget->_recursivePaintChildren(baseWidget,true,context);
+				paintedPixelCount += it->getWidth() * it->getHeight();
+			}
+
+			context->clearBaseClippingRect();
+		}
+
+		if(batchingDrawCommands)
+		{
+			drawCommands.submit();
+		}
+
+		graphicsContext->flush();
 		graphicsContext->clearClippingStack();
 		graphicsContext->setOffset(Point(0,0));
 		graphicsContext->pushClippingRect(Rectangle(Point(0,0),baseWidget->getSize()));
@@ -1398,6 +1555,49 @@ namespace agui
 			_removeWidget(widget);
 	}
 
+	void Gui::_registerWidget( Widget* widget )
+	{
+		liveWidgets.insert(widget);
+
+		for(WidgetArray::const_iterator it
+			= widget->getPrivateChildBegin(); 
+			it != widget->getPrivateChildEnd(); ++it)
+		{
+			_registerWidget(*it);
+		}
+
+		for(WidgetArray::const_iterator it 
+			= widget->getChildBegin(); 
+			it != widget->getChildEnd(); ++it)
+		{
+			_registerWidget(*it);
+		}
+	}
+
+	void Gui::_unregisterWidget( Widget* widget )
+	{
+		liveWidgets.erase(widget);
+
+		for(WidgetArray::const_iterator it
+			= widget->getPrivateChildBegin(); 
+			it != widget->getPrivateChildEnd(); ++it)
+		{
+			_unregisterWidget(*it);
+		}
+
+		for(WidgetArray::const_iterator it 
+			= widget->getChildBegin(); 
+			it != widget->getChildEnd(); ++it)
+		{
+			_unregisterWidget(*it);
+		}
+	}
+
+	bool Gui::_isWidgetRegistered( const Widget* widget ) const
+	{
+		return liveWidgets.find(widget) != liveWidgets.end();
+	}
+
 
 	void Gui::add( Widget* widget )
 	{
@@ -1726,6 +1926,204 @@ namespace agui
 		return getWidgetUnderMouse() != NULL && getWidgetUnderMouse() != getTop();
 	}
 
+	void Gui::setDirtyRendering( bool dirty )
+	{
+		dirtyRendering = dirty;
+		damagedRects.clear();
+
+		if(dirtyRendering)
+		{
+			invalidate();
+		}
+	}
+
+	bool Gui::isDirtyRendering() const
+	{
+		return dirtyRendering;
+	}
+
+	void Gui::invalidateRectangle( const Rectangle &rect )
+	{
+		drawCommandsStale = true;
+
+		if(!dirtyRendering)
+		{
+			return;
+		}
+
+		Rectangle damage = rect.getIntersection(
+			Rectangle(Point(0,0),baseWidget->getSize()));
+
+		if(damage.getWidth() <= 0 || damage.getHeight() <= 0)
+		{
+			return;
+		}
+
+		//merge overlapping rectangles so no pixel is painted twice
+		size_t i = 0;
+		while(i < damagedRects.size())
+		{
+			if(damagedRects[i].intersects(damage))
+			{
+				damage = damage.getUnion(damagedRects[i]);
+				damagedRects.erase(damagedRects.begin() + i);
+				i = 0;
+			}
+			else
+			{
+				i++;
+			}
+		}
+
+		damagedRects.push_back(damage);
+
+		//too many small rectangles cost more than one big one
+		if(damagedRects.size() > 16)
+		{
+			for(size_t j = 1; j < damagedRects.size(); ++j)
+			{
+				damagedRects[0] = damagedRects[0].getUnion(damagedRects[j]);
+			}
+
+			damagedRects.resize(1);
+		}
+	}
+
+	void Gui::invalidate()
+	{
+		invalidateRectangle(Rectangle(Point(0,0),baseWidget->getSize()));
+	}
+
+	bool Gui::hasDamage() const
+	{
+		return !dirtyRendering || !damagedRects.empty();
+	}
+
+	const std::vector<Rectangle>& Gui::getDamagedRectangles() const
+	{
+		return damagedRects;
+	}
+
+	int Gui::getPaintedWidgetCount() const
+	{
+		return paintedWidgetCount;
+	}
+
+	int Gui::getPaintedPixelCount() const
+	{
+		return paintedPixelCount;
+	}
+
+	void Gui::_widgetPainted()
+	{
+		paintedWidgetCount++;
+	}
+
+	int Gui::getCulledWidgetCount() const
+	{
+		return culledWidgetCount;
+	}
+
+	void Gui::_widgetCulled()
+	{
+		culledWidgetCount++;
+	}
+
+	void Gui::setBatchingDrawCommands( bool batching )
+	{
+		batchingDrawCommands = batching;
+		drawCommandsStale = true;
+		drawCommands.clear();
+	}
+
+	bool Gui::isBatchingDrawCommands() const
+	{
+		return batchingDrawCommands;
+	}
+
+	const DrawCommandList& Gui::getDrawCommandList() const
+	{
+		return drawCommands;
+	}
+
+	int Gui::getDrawCallCount() const
+	{
+		if(!batchingDrawCommands)
+		{
+			return 0;
+		}
+
+		return drawCommands.getDrawCallCount();
+	}
+
+	int Gui::getStateChangeCount() const
+	{
+		if(!batchingDrawCommands)
+		{
+			return 0;
+		}
+
+		return drawCommands.getStateChangeCount();
+	}
+
+	void Gui::suspendLayouts()
+	{
+		layoutSuspendCount++;
+	}
+
+	void Gui::resumeLayouts()
+	{
+		if(layoutSuspendCount > 0)
+		{
+			layoutSuspendCount--;
+		}
+
+		if(layoutSuspendCount == 0)
+		{
+			flushLayouts();
+		}
+	}
+
+	bool Gui::isLayoutSuspended() const
+	{
+		return layoutSuspendCount > 0 && !flushingLayouts;
+	}
+
+	void Gui::flushLayouts()
+	{
+		if(!hasDirtyLayouts || flushingLayouts)
+		{
+			return;
+		}
+
+		//layouts run right away while flushing so a parent lays out its
+		//child layouts and they are skipped when the walk reaches them
+		hasDirtyLayouts = false;
+		flushingLayouts = true;
+		recursiveFlushLayouts(baseWidget);
+		flushingLayouts = false;
+	}
+
+	void Gui::_layoutDirtied()
+	{
+		hasDirtyLayouts = true;
+	}
+
+	void Gui::invalidateEventTarget( Widget *target )
+	{
+		if(target == NULL)
+		{
+			return;
+		}
+
+		while(target->getParent() && target->_isPrivateChild())
+		{
+			target = target->getParent();
+		}
+
+		target->invalidate();
+	}
+
 
 
 }
@@ -64,6 +64,7 @@ namespace agui
 	}
 
 	Image::Image()
+	: lockMode(LOCK_READ_WRITE), locked(false)
 	{
 	}
 
@@ -118,4 +119,179 @@ namespace agui
 		return img;
 	}
 
+	bool Image::lock( const Rectangle &region, PixelLockEnum mode /*= LOCK_READ_WRITE*/ )
+	{
+		if(locked)
+		{
+			throw Exception("Cannot lock an image that is already locked");
+		}
+
+		if(region.getWidth() <= 0 || region.getHeight() <= 0 ||
+			region.getX() < 0 || region.getY() < 0 ||
+			region.getRight() > getWidth() || region.getBottom() > getHeight())
+		{
+			throw Exception("Cannot lock a region outside of the image");
+		}
+
+		PixelSpan pixels;
+		if(!lockRegion(region,mode,pixels))
+		{
+			return false;
+		}
+
+		lockedPixels = pixels;
+		lockedRegion = region;
+		lockMode = mode;
+		locked = true;
+		return true;
+	}
+
+	bool Image::lock( PixelLockEnum mode /*= LOCK_READ_WRITE*/ )
+	{
+		return lock(Rectangle(0,0,getWidth(),getHeight()),mode);
+	}
+
+	void Image::unlock()
+	{
+		if(!locked)
+		{
+			return;
+		}
+
+		unlockRegion();
+		lockedPixels = PixelSpan();
+		lockedRegion = Rectangle();
+		locked = false;
+	}
+
+	bool Image::isLocked() const
+	{
+		return locked;
+	}
+
+	PixelSpan Image::getLockedPixels() const
+	{
+		return lockedPixels;
+	}
+
+	const Rectangle& Image::getLockedRegion() const
+	{
+		return lockedRegion;
+	}
+
+	PixelLockEnum Image::getLockMode() const
+	{
+		return lockMode;
+	}
+
+	Color Image::getPixel( int x, int y ) const
+	{
+		if(x < 0 || y < 0 || x >= getWidth() || y >= getHeight())
+		{
+			throw Exception("Cannot obtain a pixel outside of the image");
+		}
+
+		if(locked)
+		{
+			if(lockMode == LOCK_WRITE_ONLY || !lockedRegion.pointInside(Point(x,y)))
+			{
+				throw Exception("Cannot obtain a pixel that is not locked for reading");
+			}
+
+			return lockedPixels.getPixel(x - lockedRegion.getX(),
+				y - lockedRegion.getY());
+		}
+
+		//locking does not change the pixels
+		Image* image = (Image*)this;
+		if(!image->lock(Rectangle(x,y,1,1),LOCK_READ_ONLY))
+		{
+			throw Exception("Cannot obtain the pixel of an image that cannot be locked");
+		}
+
+		Color color = lockedPixels.getPixel(0,0);
+		image->unlock();
+		return color;
+	}
+
+	void Image::setPixel( int x, int y, const Color& color )
+	{
+		if(x < 0 || y < 0 || x >= getWidth() || y >= getHeight())
+		{
+			throw Exception("Cannot set a pixel outside of the image");
+		}
+
+		if(locked)
+		{
+			if(lockMode == LOCK_READ_ONLY || !lockedRegion.pointInside(Point(x,y)))
+			{
+				throw Exception("Cannot set a pixel that is not locked for writing");
+			}
+
+			lockedPixels.setPixel(x - lockedRegion.getX(),
+				y - lockedRegion.getY(),color);
+			return;
+		}
+
+		if(!lock(Rectangle(x,y,1,1),LOCK_WRITE_ONLY))
+		{
+			throw Exception("Cannot set the pixel of an image that cannot be locked");
+		}
+
+		lockedPixels.setPixel(0,0,color);
+		unlock();
+	}
+
+	void Image::fill( const Color &color )
+	{
+		fill(Rectangle(0,0,getWidth(),getHeight()),color);
+	}
+
+	void Image::fill( const Rectangle &area, const Color &color )
+	{
+		Rectangle region = area.getIntersection(
+			Rectangle(0,0,getWidth(),getHeight()));
+		if(region.getWidth() <= 0 || region.getHeight() <= 0)
+		{
+			return;
+		}
+
+		if(!lock(region,LOCK_WRITE_ONLY))
+		{
+			throw Exception("Cannot fill an image that cannot be locked");
+		}
+
+		lockedPixels.fill(color);
+		unlock();
+	}
+
+	void Image::blit( Image* source, const Point &position )
+	{
+		Rectangle region = Rectangle(position,Dimension(source->getWidth(),
+			source->getHeight())).getIntersection(
+			Rectangle(0,0,getWidth(),getHeight()));
+		if(region.getWidth() <= 0 || region.getHeight() <= 0)
+		{
+			return;
+		}
+
+		Rectangle sourceRegion(region.getX() - position.getX(),
+			region.getY() - position.getY(),
+			region.getWidth(),region.getHeight());
+		if(!source->lock(sourceRegion,LOCK_READ_ONLY))
+		{
+			throw Exception("Cannot blit from an image that cannot be locked");
+		}
+
+		if(!lock(region,LOCK_WRITE_ONLY))
+		{
+			source->unlock();
+			throw Exception("Cannot blit to an image that cannot be locked");
+		}
+
+		lockedPixels.blit(source->getLockedPixels(),Point(0,0));
+		unlock();
+		source->unlock();
+	}
+
 }
\ No newline at end of file
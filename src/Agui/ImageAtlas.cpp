@@ -0,0 +1,153 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/ImageAtlas.hpp"
+#include <algorithm>
+
+namespace agui
+{
+	struct ImageHeightCompare
+	{
+		bool operator()(const Image* a, const Image* b) const
+		{
+			return a->getHeight() > b->getHeight();
+		}
+	};
+
+	ImageAtlas::ImageAtlas( int pageWidth /*= 1024*/, int pageHeight /*= 1024*/,
+		int padding /*= 1*/ )
+	: pageWidth(pageWidth), pageHeight(pageHeight), padding(padding),
+	pageCount(0), imageCount(0)
+	{
+	}
+
+	ImageAtlas::~ImageAtlas()
+	{
+	}
+
+	bool ImageAtlas::add( Image* image )
+	{
+		if(!image || image->getWidth() <= 0 || image->getHeight() <= 0 ||
+			image->getWidth() + 2 * padding > pageWidth ||
+			image->getHeight() + 2 * padding > pageHeight)
+		{
+			return false;
+		}
+
+		pendingImages.push_back(image);
+		return true;
+	}
+
+	void ImageAtlas::build()
+	{
+		if(pendingImages.empty())
+		{
+			return;
+		}
+
+		//rows waste the least space when their images are about as tall
+		std::stable_sort(pendingImages.begin(),pendingImages.end(),
+			ImageHeightCompare());
+
+		int page = -1;
+		int x = 0;
+		int y = 0;
+		int rowHeight = 0;
+
+		for(size_t i = 0; i < pendingImages.size(); ++i)
+		{
+			Image* image = pendingImages[i];
+			int width = image->getWidth() + 2 * padding;
+			int height = image->getHeight() + 2 * padding;
+
+			if(page >= 0 && x + width > pageWidth)
+			{
+				x = 0;
+				y += rowHeight;
+				rowHeight = 0;
+			}
+
+			if(page < 0 || y + height > pageHeight)
+			{
+				page = pageCount++;
+				createPage(page,pageWidth,pageHeight);
+				x = 0;
+				y = 0;
+				rowHeight = 0;
+			}
+
+			placeImage(image,page,Point(x + padding,y + padding));
+			imageCount++;
+
+			x += width;
+			if(height > rowHeight)
+			{
+				rowHeight = height;
+			}
+		}
+
+		pendingImages.clear();
+	}
+
+	int ImageAtlas::getPageCount() const
+	{
+		return pageCount;
+	}
+
+	int ImageAtlas::getImageCount() const
+	{
+		return imageCount;
+	}
+
+	int ImageAtlas::getPageWidth() const
+	{
+		return pageWidth;
+	}
+
+	int ImageAtlas::getPageHeight() const
+	{
+		return pageHeight;
+	}
+
+	int ImageAtlas::getPadding() const
+	{
+		return padding;
+	}
+}
@@ -39,13 +39,15 @@
  */
 
 #include "Agui/Layout.hpp"
+#include "Agui/Gui.hpp"
 
 namespace agui
 {
 	Layout::Layout(void)
 	:isLayingOut(false), resizeToParent(true),
 	filterVisibility(true),updateOnChildRelocation(true),
-	updateOnChildResize(true),updateOnChildAddRemove(true)
+	updateOnChildResize(true),updateOnChildAddRemove(true),
+	layoutSuspendCount(0),layoutDirty(false)
 	{
 		setIsLayout(true);
 	}
@@ -79,6 +81,7 @@ namespace agui
 	{
 		Widget::add(widget);
 		widget->addWidgetListener(this);
+		invalidatePreferredSize();
 
 		if(updateOnChildAddRemove)
 		updateLayout();
@@ -88,6 +91,7 @@ namespace agui
 	{
 		Widget::remove(widget);
 		widget->removeWidgetListener(this);
+		invalidatePreferredSize();
 
 		if(updateOnChildAddRemove)
 		updateLayout();
@@ -106,15 +110,14 @@ namespace agui
 	{
 		if(!isLayingOut && isUpdatingOnChildRelocate())
 		{
-			isLayingOut = true;
-			layoutChildren();
-			isLayingOut = false;
+			updateLayout();
 		}
 		
 	}
 
 	void Layout::sizeChanged( Widget* source, const Dimension &size )
 	{
+		invalidatePreferredSize();
 		if(!isLayingOut && isUpdatingOnChildResize())
 		{
 			updateLayout();
@@ -122,13 +125,74 @@ namespace agui
 		
 	}
 
+	void Layout::textEdited( Widget* source, int index,
+		int removedLength, int insertedLength )
+	{
+		(void)source; (void)index; (void)removedLength; (void)insertedLength;
+	}
+
 	void Layout::updateLayout()
 	{
+		if(isLayoutSuspended())
+		{
+			layoutDirty = true;
+
+			//a layout suspended on its own is laid out by resumeLayout
+			if(layoutSuspendCount == 0 && getGui())
+			{
+				getGui()->_layoutDirtied();
+			}
+			return;
+		}
+
+		layoutDirty = false;
 		isLayingOut = true;
+		sizeChildren();
 		layoutChildren();
 		isLayingOut = false;
 	}
 
+	void Layout::sizeChildren()
+	{
+	}
+
+	void Layout::suspendLayout()
+	{
+		layoutSuspendCount++;
+	}
+
+	void Layout::resumeLayout()
+	{
+		if(layoutSuspendCount > 0)
+		{
+			layoutSuspendCount--;
+		}
+
+		if(layoutDirty)
+		{
+			updateLayout();
+		}
+	}
+
+	bool Layout::isLayoutSuspended() const
+	{
+		return layoutSuspendCount > 0 ||
+			(getGui() && getGui()->isLayoutSuspended());
+	}
+
+	bool Layout::isLayoutDirty() const
+	{
+		return layoutDirty;
+	}
+
+	void Layout::_flushLayout()
+	{
+		if(layoutDirty && layoutSuspendCount == 0)
+		{
+			updateLayout();
+		}
+	}
+
 	void Layout::parentSizeChanged()
 	{
 		if( resizeToParent && getParent())
@@ -153,6 +217,7 @@ namespace agui
 
 	void Layout::visibilityChanged( Widget* source, bool visible )
 	{
+		invalidatePreferredSize();
 		if(isFilteringVisibility())
 		if(!isLayingOut)
 		updateLayout();
@@ -161,6 +226,7 @@ namespace agui
 	void Layout::setFilterVisibility( bool filter )
 	{
 		filterVisibility = filter;
+		invalidatePreferredSize();
 		updateLayout();
 	}
 
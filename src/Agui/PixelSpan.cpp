@@ -0,0 +1,265 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/PixelSpan.hpp"
+#include <cstring>
+
+namespace agui
+{
+	static unsigned char colorComponentToByte(float value)
+	{
+		if(value <= 0.0f)
+		{
+			return 0;
+		}
+		if(value >= 1.0f)
+		{
+			return 255;
+		}
+
+		return (unsigned char)(value * 255.0f + 0.5f);
+	}
+
+	//reads any format into R, G, B, A bytes
+	static void readPixel(const unsigned char* p, PixelFormatEnum format,
+		unsigned char* rgba)
+	{
+		switch(format)
+		{
+		case PIXEL_FORMAT_BGRA_8888:
+			rgba[0] = p[2];
+			rgba[1] = p[1];
+			rgba[2] = p[0];
+			rgba[3] = p[3];
+			break;
+		case PIXEL_FORMAT_RGB_888:
+			rgba[0] = p[0];
+			rgba[1] = p[1];
+			rgba[2] = p[2];
+			rgba[3] = 255;
+			break;
+		default:
+			memcpy(rgba,p,4);
+			break;
+		}
+	}
+
+	static void writePixel(unsigned char* p, PixelFormatEnum format,
+		const unsigned char* rgba)
+	{
+		switch(format)
+		{
+		case PIXEL_FORMAT_BGRA_8888:
+			p[0] = rgba[2];
+			p[1] = rgba[1];
+			p[2] = rgba[0];
+			p[3] = rgba[3];
+			break;
+		case PIXEL_FORMAT_RGB_888:
+			p[0] = rgba[0];
+			p[1] = rgba[1];
+			p[2] = rgba[2];
+			break;
+		default:
+			memcpy(p,rgba,4);
+			break;
+		}
+	}
+
+	static void colorToBytes(const Color &color, unsigned char* rgba)
+	{
+		rgba[0] = colorComponentToByte(color.getR());
+		rgba[1] = colorComponentToByte(color.getG());
+		rgba[2] = colorComponentToByte(color.getB());
+		rgba[3] = colorComponentToByte(color.getA());
+	}
+
+	PixelSpan::PixelSpan()
+	: data(NULL), pitch(0), format(PIXEL_FORMAT_RGBA_8888),
+	width(0), height(0)
+	{
+	}
+
+	PixelSpan::PixelSpan( unsigned char* data, int pitch,
+		PixelFormatEnum format, int width, int height )
+	: data(data), pitch(pitch), format(format),
+	width(width), height(height)
+	{
+	}
+
+	unsigned char* PixelSpan::getData() const
+	{
+		return data;
+	}
+
+	unsigned char* PixelSpan::getRow( int y ) const
+	{
+		return data + y * pitch;
+	}
+
+	int PixelSpan::getPitch() const
+	{
+		return pitch;
+	}
+
+	PixelFormatEnum PixelSpan::getFormat() const
+	{
+		return format;
+	}
+
+	int PixelSpan::getWidth() const
+	{
+		return width;
+	}
+
+	int PixelSpan::getHeight() const
+	{
+		return height;
+	}
+
+	bool PixelSpan::isEmpty() const
+	{
+		return !data || width <= 0 || height <= 0;
+	}
+
+	Color PixelSpan::getPixel( int x, int y ) const
+	{
+		unsigned char rgba[4];
+		readPixel(getRow(y) + x * getBytesPerPixel(format),format,rgba);
+		return Color((int)rgba[0],(int)rgba[1],(int)rgba[2],(int)rgba[3]);
+	}
+
+	void PixelSpan::setPixel( int x, int y, const Color &color )
+	{
+		unsigned char rgba[4];
+		colorToBytes(color,rgba);
+		writePixel(getRow(y) + x * getBytesPerPixel(format),format,rgba);
+	}
+
+	void PixelSpan::fill( const Color &color )
+	{
+		fill(Rectangle(0,0,width,height),color);
+	}
+
+	void PixelSpan::fill( const Rectangle &area, const Color &color )
+	{
+		Rectangle r = area.getIntersection(Rectangle(0,0,width,height));
+		if(!data || r.getWidth() <= 0 || r.getHeight() <= 0)
+		{
+			return;
+		}
+
+		unsigned char rgba[4];
+		unsigned char pixel[4];
+		colorToBytes(color,rgba);
+		writePixel(pixel,format,rgba);
+
+		//build the first row, then copy it to the others
+		int bpp = getBytesPerPixel(format);
+		int rowBytes = r.getWidth() * bpp;
+		unsigned char* first = getRow(r.getY()) + r.getX() * bpp;
+		for(int x = 0; x < r.getWidth(); ++x)
+		{
+			memcpy(first + x * bpp,pixel,bpp);
+		}
+
+		for(int y = 1; y < r.getHeight(); ++y)
+		{
+			memcpy(getRow(r.getY() + y) + r.getX() * bpp,first,rowBytes);
+		}
+	}
+
+	void PixelSpan::blit( const PixelSpan &source, const Point &position )
+	{
+		Rectangle r = Rectangle(position,Dimension(source.width,source.height)).
+			getIntersection(Rectangle(0,0,width,height));
+		if(!data || !source.data || r.getWidth() <= 0 || r.getHeight() <= 0)
+		{
+			return;
+		}
+
+		int srcX = r.getX() - position.getX();
+		int srcY = r.getY() - position.getY();
+		convert(source.getRow(srcY) + srcX * getBytesPerPixel(source.format),
+			source.pitch,source.format,
+			getRow(r.getY()) + r.getX() * getBytesPerPixel(format),
+			pitch,format,r.getWidth(),r.getHeight());
+	}
+
+	void PixelSpan::convert( const unsigned char* source, int sourcePitch,
+		PixelFormatEnum sourceFormat,
+		unsigned char* destination, int destinationPitch,
+		PixelFormatEnum destinationFormat,
+		int width, int height )
+	{
+		if(width <= 0)
+		{
+			return;
+		}
+
+		int srcBpp = getBytesPerPixel(sourceFormat);
+		int dstBpp = getBytesPerPixel(destinationFormat);
+		for(int y = 0; y < height; ++y)
+		{
+			const unsigned char* src = source + y * sourcePitch;
+			unsigned char* dst = destination + y * destinationPitch;
+
+			if(sourceFormat == destinationFormat)
+			{
+				memcpy(dst,src,width * dstBpp);
+				continue;
+			}
+
+			unsigned char rgba[4];
+			for(int x = 0; x < width; ++x)
+			{
+				readPixel(src,sourceFormat,rgba);
+				writePixel(dst,destinationFormat,rgba);
+				src += srcBpp;
+				dst += dstBpp;
+			}
+		}
+	}
+
+	int PixelSpan::getBytesPerPixel( PixelFormatEnum format )
+	{
+		return format == PIXEL_FORMAT_RGB_888 ? 3 : 4;
+	}
+}
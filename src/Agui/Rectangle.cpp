@@ -153,4 +153,35 @@ namespace agui
 	{
 		return Dimension(getWidth(),getHeight());
 	}
+
+	bool Rectangle::intersects( const Rectangle &rect ) const
+	{
+		return getLeft() < rect.getRight() && rect.getLeft() < getRight() &&
+			getTop() < rect.getBottom() && rect.getTop() < getBottom();
+	}
+
+	Rectangle Rectangle::getIntersection( const Rectangle &rect ) const
+	{
+		if(!intersects(rect))
+		{
+			return Rectangle(0,0,0,0);
+		}
+
+		int l = getLeft() > rect.getLeft() ? getLeft() : rect.getLeft();
+		int t = getTop() > rect.getTop() ? getTop() : rect.getTop();
+		int r = getRight() < rect.getRight() ? getRight() : rect.getRight();
+		int b = getBottom() < rect.getBottom() ? getBottom() : rect.getBottom();
+
+		return fromTLBR(t,l,b,r);
+	}
+
+	Rectangle Rectangle::getUnion( const Rectangle &rect ) const
+	{
+		int l = getLeft() < rect.getLeft() ? getLeft() : rect.getLeft();
+		int t = getTop() < rect.getTop() ? getTop() : rect.getTop();
+		int r = getRight() > rect.getRight() ? getRight() : rect.getRight();
+		int b = getBottom() > rect.getBottom() ? getBottom() : rect.getBottom();
+
+		return fromTLBR(t,l,b,r);
+	}
 }
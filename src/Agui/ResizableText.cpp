@@ -41,6 +41,7 @@
 #include "Agui/ResizableText.hpp"
 #include "Agui/Graphics.hpp"
 #include "Agui/Font.hpp"
+#include <algorithm>
 namespace agui
 {
 	void ResizableText::drawTextArea( Graphics *g, 
@@ -53,7 +54,6 @@ namespace agui
 
 		int lagHeight = 0;
 		int wordWidth = 0;
-		int lagWidth = 0;
 		int verticalOffset = 0;
 
 		lagHeight = area.getHeight() - (font->getLineHeight() * (int)lines.size());
@@ -80,25 +80,8 @@ namespace agui
 
 		for(size_t i = 0; i < lines.size(); ++i)
 		{
-			wordWidth = font->getTextWidth(lines[i]) ;
-			lagWidth = area.getWidth() - wordWidth;
-
-			if(align == ALIGN_TOP_RIGHT    ||
-				align == ALIGN_MIDDLE_RIGHT ||
-				align == ALIGN_BOTTOM_RIGHT)
-			{
-				curPosX = area.getLeft() + lagWidth - 2;
-			}
-			else if(align == ALIGN_TOP_CENTER     ||
-				align == ALIGN_MIDDLE_CENTER  ||
-				align == ALIGN_BOTTOM_CENTER)
-			{
-				curPosX = area.getLeft() + (lagWidth / 2);
-			}
-			else // align left
-			{
-				curPosX = area.getLeft();
-			}
+			wordWidth = font->getTextAdvance(lines[i]) ;
+			curPosX = area.getLeft() + alignLine(area.getWidth(),wordWidth,align);
 
 
 			if(curPosY > area.getBottom() - font->getLineHeight() && i > 0)
@@ -117,6 +100,161 @@ namespace agui
 	}
 
 
+	int ResizableText::alignLine( int width, int lineWidth, AreaAlignmentEnum align ) const
+	{
+		int lagWidth = width - lineWidth;
+
+		if(align == ALIGN_TOP_RIGHT    ||
+			align == ALIGN_MIDDLE_RIGHT ||
+			align == ALIGN_BOTTOM_RIGHT)
+		{
+			return lagWidth - 2;
+		}
+		else if(align == ALIGN_TOP_CENTER     ||
+			align == ALIGN_MIDDLE_CENTER  ||
+			align == ALIGN_BOTTOM_CENTER)
+		{
+			return lagWidth / 2;
+		}
+
+		return 0;
+	}
+
+	void ResizableText::alignShapedText()
+	{
+		shapedText.lineOffsets.resize(shapedText.lines.size());
+		for(size_t i = 0; i < shapedText.lines.size(); ++i)
+		{
+			shapedText.lineOffsets[i] = alignLine(shapedText.maxWidth,
+				shapedText.lineWidths[i],shapedText.alignment);
+		}
+	}
+
+	const ShapedText& ResizableText::shapeText( const Font *font,
+		const std::string &text, int maxWidth, AreaAlignmentEnum align )
+	{
+		ShapedText &s = shapedText;
+		if(s.valid && s.font == font && s.singleLine == singleLine &&
+			s.wantEllipsis == wantEllipsis && s.text == text)
+		{
+			//no check in makeTextLines passes at a greater width
+			//if none passed at this one, so the lines stay the same
+			if(s.maxWidth == maxWidth ||
+				(!s.widthLimited && maxWidth > s.maxWidth))
+			{
+				if(s.maxWidth != maxWidth || s.alignment != align)
+				{
+					s.maxWidth = maxWidth;
+					s.alignment = align;
+					alignShapedText();
+				}
+
+				return s;
+			}
+		}
+
+		s.font = font;
+		s.text = text;
+		s.maxWidth = maxWidth;
+		s.alignment = align;
+		s.singleLine = singleLine;
+		s.wantEllipsis = wantEllipsis;
+		s.ellipsisLine = -1;
+
+		if(!font)
+		{
+			s.lines.clear();
+			s.lineWidths.clear();
+			s.lineOffsets.clear();
+			s.lineHeight = 0;
+			s.valid = false;
+			return s;
+		}
+
+		s.lineHeight = font->getLineHeight();
+
+		makeTextLines(font,text,s.lines,maxWidth);
+
+		s.lineWidths.resize(s.lines.size());
+		for(size_t i = 0; i < s.lines.size(); ++i)
+		{
+			s.lineWidths[i] = font->getTextAdvance(s.lines[i]);
+		}
+
+		//the width only ever adds line breaks or cuts the single line
+		if(singleLine)
+		{
+			std::string whole = text;
+			whole.erase(std::remove(whole.begin(),whole.end(),'\n'),whole.end());
+			s.widthLimited = s.lines.size() != 1 || s.lines[0] != whole;
+			if(s.widthLimited && wantEllipsis)
+			{
+				s.ellipsisLine = 0;
+			}
+		}
+		else
+		{
+			size_t hardLines = std::count(text.begin(),text.end(),'\n') + 1;
+			s.widthLimited = s.lines.size() != hardLines;
+		}
+
+		alignShapedText();
+		s.valid = true;
+		return s;
+	}
+
+	const ShapedText& ResizableText::getShapedText() const
+	{
+		return shapedText;
+	}
+
+	void ResizableText::invalidateShapedText()
+	{
+		shapedText.valid = false;
+	}
+
+	void ResizableText::drawShapedText( Graphics *g, const Rectangle &area,
+		const Color &color, const ShapedText &text ) const
+	{
+		const AreaAlignmentEnum align = text.getAlignment();
+		const int lineHeight = text.getLineHeight();
+		int curPosY = area.getTop();
+		int verticalOffset = 0;
+		int lagHeight = area.getHeight() - (lineHeight * text.getLineCount());
+
+		if(align == ALIGN_MIDDLE_CENTER ||
+			align == ALIGN_MIDDLE_LEFT   ||
+			align == ALIGN_MIDDLE_RIGHT)
+		{
+			verticalOffset = (lagHeight / 2);
+		}
+		else if(align == ALIGN_BOTTOM_CENTER ||
+			align == ALIGN_BOTTOM_LEFT   ||
+			align == ALIGN_BOTTOM_RIGHT)
+		{
+			verticalOffset = lagHeight;
+		}
+
+		if(verticalOffset < 0)
+		{
+			verticalOffset = 0;
+		}
+
+		for(int i = 0; i < text.getLineCount(); ++i)
+		{
+			if(curPosY > area.getBottom() - lineHeight && i > 0)
+			{
+				return;
+			}
+
+			g->drawText(Point(area.getLeft() + text.getLineOffset(i),
+				curPosY + verticalOffset),
+				text.getLines()[i].c_str(),color,text.getFont());
+
+			curPosY += lineHeight;
+		}
+	}
+
 	void ResizableText::makeTextLines( const Font *font,const std::string &text, std::vector<std::string> &textRows, int maxWidth )
 	{
 		if(singleLine)
@@ -182,7 +320,8 @@ namespace agui
 
 			bytesSkipped += letterLength;
 
-			curLetterWidth = font->getTextWidth(curStr);
+			curLetterWidth = font->getGlyphAdvance(
+				utf8Manager.decodeUtf8(curStr.c_str(),curStr.length()));
 
 			//push a new line
 			if(curStr == "\n")
@@ -275,13 +414,13 @@ namespace agui
 		int textWidth = 0;
 		if(wantEllipsis)
 		{
-			textWidth = font->getTextWidth(text);
+			textWidth = font->getTextAdvance(text);
 		}
 
 		bool wontFit = textWidth > maxWidth;
 		if(wantEllipsis && wontFit)
 		{
-			ellipsisWidth = font->getTextWidth("...");
+			ellipsisWidth = font->getTextAdvance("...");
 		}
 
 		for(int i = 0; i < len; ++i)
@@ -306,7 +445,10 @@ namespace agui
 				continue;
 			}
 
-			if(wontFit && font->getTextWidth(textRows.back() + curStr + "...") > maxWidth)
+			curLetterWidth = font->getGlyphAdvance(
+				utf8Manager.decodeUtf8(curStr.c_str(),curStr.length()));
+
+			if(wontFit && curLineWidth + curLetterWidth + ellipsisWidth > maxWidth)
 			{
 				if(wantEllipsis)
 				{
@@ -317,7 +459,7 @@ namespace agui
 			else
 			{
 				textRows.back() += curStr;
-				curLineWidth = font->getTextWidth(textRows.back());
+				curLineWidth += curLetterWidth;
 			}
 		}
 
@@ -47,4 +47,9 @@ namespace agui {
 	SelectionListener::~SelectionListener(void)
 	{
 	}
+
+	void SelectionListener::selectionRangeChanged( Widget *source, int startIndex, int endIndex, bool selected )
+	{
+		(void)source; (void)startIndex; (void)endIndex; (void)selected;
+	}
 }
@@ -0,0 +1,111 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/ShapedText.hpp"
+
+namespace agui
+{
+	ShapedText::ShapedText()
+	: font(NULL), maxWidth(0), alignment(ALIGN_TOP_LEFT),
+	singleLine(false), wantEllipsis(false), widthLimited(false),
+	valid(false), lineHeight(0), ellipsisLine(-1)
+	{
+	}
+
+	bool ShapedText::isValid() const
+	{
+		return valid;
+	}
+
+	const Font* ShapedText::getFont() const
+	{
+		return font;
+	}
+
+	const std::string& ShapedText::getText() const
+	{
+		return text;
+	}
+
+	int ShapedText::getMaxWidth() const
+	{
+		return maxWidth;
+	}
+
+	AreaAlignmentEnum ShapedText::getAlignment() const
+	{
+		return alignment;
+	}
+
+	int ShapedText::getLineHeight() const
+	{
+		return lineHeight;
+	}
+
+	const std::vector<std::string>& ShapedText::getLines() const
+	{
+		return lines;
+	}
+
+	int ShapedText::getLineCount() const
+	{
+		return int(lines.size());
+	}
+
+	int ShapedText::getLineWidth( int line ) const
+	{
+		return lineWidths[line];
+	}
+
+	int ShapedText::getLineOffset( int line ) const
+	{
+		return lineOffsets[line];
+	}
+
+	int ShapedText::getEllipsisLine() const
+	{
+		return ellipsisLine;
+	}
+
+	bool ShapedText::isWidthLimited() const
+	{
+		return widthLimited;
+	}
+}
@@ -0,0 +1,158 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/SpatialIndex.hpp"
+#include <cmath>
+namespace agui
+{
+	SpatialIndex::SpatialIndex()
+		: columns(0), rows(0), cellWidth(1), cellHeight(1)
+	{
+	}
+
+	SpatialIndex::~SpatialIndex()
+	{
+	}
+
+	void SpatialIndex::clear()
+	{
+		rects.clear();
+		cells.clear();
+		bounds = Rectangle();
+		columns = 0;
+		rows = 0;
+	}
+
+	void SpatialIndex::build( const std::vector<Rectangle> &rects )
+	{
+		clear();
+		this->rects = rects;
+
+		//find the area covered by the rectangles that can contain a point
+		bool first = true;
+		int left = 0;
+		int top = 0;
+		int right = 0;
+		int bottom = 0;
+		for(std::vector<Rectangle>::const_iterator it = rects.begin();
+			it != rects.end(); ++it)
+		{
+			if(it->getWidth() <= 0 || it->getHeight() <= 0)
+			{
+				continue;
+			}
+
+			if(first || it->getLeft() < left)
+				left = it->getLeft();
+			if(first || it->getTop() < top)
+				top = it->getTop();
+			if(first || it->getRight() > right)
+				right = it->getRight();
+			if(first || it->getBottom() > bottom)
+				bottom = it->getBottom();
+			first = false;
+		}
+
+		if(first)
+		{
+			return;
+		}
+
+		bounds = Rectangle(left,top,right - left,bottom - top);
+
+		//about one rectangle per cell when they are laid out evenly
+		int side = (int)ceil(sqrt((double)rects.size()));
+		if(side < 1)
+		{
+			side = 1;
+		}
+
+		columns = side < bounds.getWidth() ? side : bounds.getWidth();
+		rows = side < bounds.getHeight() ? side : bounds.getHeight();
+		cellWidth = (bounds.getWidth() + columns - 1) / columns;
+		cellHeight = (bounds.getHeight() + rows - 1) / rows;
+		cells.resize(columns * rows);
+
+		for(size_t i = 0; i < rects.size(); ++i)
+		{
+			const Rectangle &r = rects[i];
+			if(r.getWidth() <= 0 || r.getHeight() <= 0)
+			{
+				continue;
+			}
+
+			int c0 = (r.getLeft() - left) / cellWidth;
+			int c1 = (r.getRight() - 1 - left) / cellWidth;
+			int r0 = (r.getTop() - top) / cellHeight;
+			int r1 = (r.getBottom() - 1 - top) / cellHeight;
+
+			for(int y = r0; y <= r1; ++y)
+			{
+				for(int x = c0; x <= c1; ++x)
+				{
+					cells[y * columns + x].push_back(int(i));
+				}
+			}
+		}
+	}
+
+	void SpatialIndex::getItemsAt( const Point &p, std::vector<int> &items ) const
+	{
+		items.clear();
+
+		if(cells.empty() || !bounds.pointInside(p))
+		{
+			return;
+		}
+
+		int x = (p.getX() - bounds.getLeft()) / cellWidth;
+		int y = (p.getY() - bounds.getTop()) / cellHeight;
+		const std::vector<int> &cell = cells[y * columns + x];
+
+		for(std::vector<int>::const_iterator it = cell.begin();
+			it != cell.end(); ++it)
+		{
+			if(rects[*it].pointInside(p))
+			{
+				items.push_back(*it);
+			}
+		}
+	}
+}
@@ -0,0 +1,145 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/SpriteBatch.hpp"
+
+namespace agui
+{
+	SpriteBatch::SpriteBatch()
+	: texture(NULL), batching(true), batchCount(0),
+	spriteCount(0), culledSpriteCount(0)
+	{
+	}
+
+	SpriteBatch::~SpriteBatch()
+	{
+	}
+
+	void SpriteBatch::setSpriteClippingRectangle( const Rectangle &rect )
+	{
+		clip = rect;
+	}
+
+	void SpriteBatch::addSprite( const void* texture, const Rectangle &bounds,
+		const Rectangle &destination, const Rectangle &source, float opacity )
+	{
+		int left = destination.getLeft() > clip.getLeft() ?
+			destination.getLeft() : clip.getLeft();
+		int top = destination.getTop() > clip.getTop() ?
+			destination.getTop() : clip.getTop();
+		int right = destination.getRight() < clip.getRight() ?
+			destination.getRight() : clip.getRight();
+		int bottom = destination.getBottom() < clip.getBottom() ?
+			destination.getBottom() : clip.getBottom();
+
+		if(right <= left || bottom <= top ||
+			source.getWidth() <= 0 || source.getHeight() <= 0)
+		{
+			culledSpriteCount++;
+			return;
+		}
+
+		if(texture != this->texture)
+		{
+			flushSprites();
+			this->texture = texture;
+		}
+
+		Sprite sprite;
+		sprite.destination = destination;
+		sprite.visible = Rectangle(left,top,right - left,bottom - top);
+		sprite.source = source;
+		sprite.bounds = bounds;
+		sprite.opacity = opacity;
+		sprites.push_back(sprite);
+
+		if(!batching)
+		{
+			flushSprites();
+		}
+	}
+
+	void SpriteBatch::flushSprites()
+	{
+		if(sprites.empty())
+		{
+			return;
+		}
+
+		batchCount++;
+		spriteCount += int(sprites.size());
+
+		drawSprites(texture,sprites);
+		sprites.clear();
+	}
+
+	void SpriteBatch::setSpriteBatching( bool batching )
+	{
+		flushSprites();
+		this->batching = batching;
+	}
+
+	bool SpriteBatch::isSpriteBatching() const
+	{
+		return batching;
+	}
+
+	int SpriteBatch::getSpriteBatchCount() const
+	{
+		return batchCount;
+	}
+
+	int SpriteBatch::getSpriteCount() const
+	{
+		return spriteCount;
+	}
+
+	int SpriteBatch::getCulledSpriteCount() const
+	{
+		return culledSpriteCount;
+	}
+
+	void SpriteBatch::resetSpriteBatchCounters()
+	{
+		batchCount = 0;
+		spriteCount = 0;
+		culledSpriteCount = 0;
+	}
+}
@@ -45,7 +45,7 @@ namespace agui
 {
 	TableLayout::TableLayout(void)
 		:horizontalSpacing(5),verticalSpacing(5),
-		rows(1),columns(1)
+		rows(1),columns(1),measuredColumns(0)
 	{
 	}
 
@@ -53,13 +53,17 @@ namespace agui
 	{
 	}
 
-	void TableLayout::layoutChildren()
+	Dimension TableLayout::computePreferredSize()
 	{
+		columnWidths.clear();
+		rowHeights.clear();
+		measuredColumns = 0;
+
 		//dividing by zero is rather silly...
 		//so we won't let it happen!
 		if (rows == 0 && columns == 0)
 		{
-			return;
+			return Widget::computePreferredSize();
 		}
 
 		int numChildren = 0;
@@ -74,13 +78,9 @@ namespace agui
 
 		if (numChildren == 0)
 		{
-			return;
+			return Widget::computePreferredSize();
 		}
 
-
-		int sizeX = 0;
-		int sizeY = 0;
-
 		int childrenInRow = rows;
 		int childrenInColumn = columns;
 		if (rows == 0)
@@ -105,7 +105,6 @@ namespace agui
 		int xCount = 0;
 		int yCount = 0;
 
-    std::vector<int> columnWidths;
     columnWidths.resize(this->columns);
 
     int rowsCount = 0;
@@ -132,7 +131,6 @@ namespace agui
     }
     rows = rowsCount;
 
-    std::vector<int> rowHeights;
     rowHeights.resize(this->rows);
 
     xCount = 0;
@@ -157,12 +155,37 @@ namespace agui
 				yCount++;
 			}
     }
+    measuredColumns = childrenInColumn;
+
+    int width = 0;
+    for (size_t i = 0; i < columnWidths.size(); i++)
+      width += columnWidths[i];
+    width += (this->columns - 1) * this->horizontalSpacing;
+
+    int height = 0;
+    for (size_t i = 0; i < rowHeights.size(); i++)
+      height += rowHeights[i];
+    height += (this->rows -1) * this->verticalSpacing;
+
+    return Dimension(width + getMargin(SIDE_LEFT) + getMargin(SIDE_RIGHT),
+                     height + getMargin(SIDE_TOP) + getMargin(SIDE_BOTTOM));
+	}
 
+	void TableLayout::layoutChildren()
+	{
+		//the measure is cached until a child or a setting changes
+		Dimension size = getPreferredSize();
+		if (measuredColumns == 0)
+		{
+			return;
+		}
+
+		int childrenInColumn = measuredColumns;
     int locationX = 0;
     int locationY = 0;
 
-    xCount = 0;
-    yCount = 0;
+    int xCount = 0;
+    int yCount = 0;
 
     for (WidgetArray::iterator it = getChildBegin(); 
 			it != getChildEnd(); ++it)
@@ -192,19 +215,8 @@ namespace agui
 			}
 		}
 
-    int width = 0;
-    for (size_t i = 0; i < columnWidths.size(); i++)
-      width += columnWidths[i];
-    width += (this->columns - 1) * this->horizontalSpacing;
-
-    int height = 0;
-    for (size_t i = 0; i < rowHeights.size(); i++)
-      height += rowHeights[i];
-    height += (this->rows -1) * this->verticalSpacing;
-
     // called to prevent to recursively call this function as reaction to set size
-    Widget::setSize(Dimension(width + getMargin(SIDE_LEFT) + getMargin(SIDE_RIGHT),
-                              height + getMargin(SIDE_TOP) + getMargin(SIDE_BOTTOM)));
+    Widget::setSize(size);
 	}
 
 	void TableLayout::setNumberOfRows( int rows )
@@ -215,6 +227,7 @@ namespace agui
 		}
 
 		this->rows = rows;
+		invalidatePreferredSize();
 		updateLayout();
 	}
 
@@ -225,18 +238,21 @@ namespace agui
 			columns = 0;
 		}
 		this->columns = columns;
+		invalidatePreferredSize();
 		updateLayout();
 	}
 
 	void TableLayout::setHorizontalSpacing( int spacing )
 	{
 		horizontalSpacing = spacing;
+		invalidatePreferredSize();
 		updateLayout();
 	}
 
 	void TableLayout::setVerticalSpacing( int spacing )
 	{
 		verticalSpacing = spacing;
+		invalidatePreferredSize();
 	}
 
 	int TableLayout::getNumberOfRows() const
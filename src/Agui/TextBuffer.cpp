@@ -0,0 +1,610 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/TextBuffer.hpp"
+#include "Agui/Font.hpp"
+#include <cstring>
+
+namespace agui
+{
+	//pieces are kept small so that searching inside of one is cheap
+	static const size_t MAX_PIECE_BYTES = 1024;
+
+	TextBuffer::TextBuffer()
+	: root(NULL), flat(true), seed(2463534242u)
+	{
+	}
+
+	TextBuffer::~TextBuffer()
+	{
+		destroy(root);
+	}
+
+	const char* TextBuffer::getPieceText( const Piece* piece ) const
+	{
+		if(piece->added)
+		{
+			return added.data() + piece->start;
+		}
+
+		return original.data() + piece->start;
+	}
+
+	TextBuffer::Piece* TextBuffer::createPiece( bool added, size_t start, size_t bytes ) const
+	{
+		Piece* piece = new Piece();
+		piece->added = added;
+		piece->start = start;
+		piece->bytes = bytes;
+		piece->left = NULL;
+		piece->right = NULL;
+
+		//xorshift, the priorities only need to be well spread
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		piece->priority = seed;
+
+		countPiece(piece);
+		update(piece);
+		return piece;
+	}
+
+	TextBuffer::Piece* TextBuffer::createPieces( bool added, size_t start, size_t bytes ) const
+	{
+		const std::string &source = added ? this->added : original;
+		Piece* pieces = NULL;
+		size_t end = start + bytes;
+
+		while(start < end)
+		{
+			size_t pieceEnd = start + MAX_PIECE_BYTES;
+			if(pieceEnd >= end)
+			{
+				pieceEnd = end;
+			}
+			else
+			{
+				//do not split a UTF8 character
+				while(pieceEnd > start + 1 &&
+					((unsigned char)source[pieceEnd] & 0xC0) == 0x80)
+				{
+					pieceEnd--;
+				}
+			}
+
+			pieces = merge(pieces,createPiece(added,start,pieceEnd - start));
+			start = pieceEnd;
+		}
+
+		return pieces;
+	}
+
+	void TextBuffer::countPiece( Piece* piece ) const
+	{
+		const char* text = getPieceText(piece);
+		piece->chars = 0;
+		piece->newlines = 0;
+
+		for(size_t i = 0; i < piece->bytes; ++i)
+		{
+			unsigned char c = text[i];
+			if((c & 0xC0) != 0x80)
+			{
+				piece->chars++;
+			}
+			if(c == '\n')
+			{
+				piece->newlines++;
+			}
+		}
+	}
+
+	void TextBuffer::update( Piece* piece ) const
+	{
+		piece->totalBytes = piece->bytes;
+		piece->totalChars = piece->chars;
+		piece->totalNewlines = piece->newlines;
+
+		if(piece->left)
+		{
+			piece->totalBytes += piece->left->totalBytes;
+			piece->totalChars += piece->left->totalChars;
+			piece->totalNewlines += piece->left->totalNewlines;
+		}
+
+		if(piece->right)
+		{
+			piece->totalBytes += piece->right->totalBytes;
+			piece->totalChars += piece->right->totalChars;
+			piece->totalNewlines += piece->right->totalNewlines;
+		}
+	}
+
+	TextBuffer::Piece* TextBuffer::merge( Piece* left, Piece* right ) const
+	{
+		if(!left)
+		{
+			return right;
+		}
+		if(!right)
+		{
+			return left;
+		}
+
+		if(left->priority > right->priority)
+		{
+			left->right = merge(left->right,right);
+			update(left);
+			return left;
+		}
+
+		right->left = merge(left,right->left);
+		update(right);
+		return right;
+	}
+
+	void TextBuffer::split( Piece* piece, int index, Piece* &left, Piece* &right ) const
+	{
+		if(!piece)
+		{
+			left = NULL;
+			right = NULL;
+			return;
+		}
+
+		int leftChars = piece->left ? piece->left->totalChars : 0;
+
+		if(index <= leftChars)
+		{
+			split(piece->left,index,left,piece->left);
+			update(piece);
+			right = piece;
+		}
+		else if(index >= leftChars + piece->chars)
+		{
+			split(piece->right,index - leftChars - piece->chars,piece->right,right);
+			update(piece);
+			left = piece;
+		}
+		else
+		{
+			//the index is inside of this piece so cut it in two
+			size_t offset = getPieceByteOffset(piece,index - leftChars);
+			Piece* second = createPiece(piece->added,piece->start + offset,
+				piece->bytes - offset);
+			piece->bytes = offset;
+			countPiece(piece);
+
+			Piece* after = piece->right;
+			piece->right = NULL;
+			update(piece);
+
+			left = piece;
+			right = merge(second,after);
+		}
+	}
+
+	size_t TextBuffer::getPieceByteOffset( const Piece* piece, int index ) const
+	{
+		const char* text = getPieceText(piece);
+		int chars = -1;
+
+		for(size_t i = 0; i < piece->bytes; ++i)
+		{
+			if(((unsigned char)text[i] & 0xC0) != 0x80)
+			{
+				chars++;
+				if(chars == index)
+				{
+					return i;
+				}
+			}
+		}
+
+		return piece->bytes;
+	}
+
+	bool TextBuffer::extendLast( Piece* piece, size_t start, size_t bytes )
+	{
+		if(!piece)
+		{
+			return false;
+		}
+
+		if(piece->right)
+		{
+			if(!extendLast(piece->right,start,bytes))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			//typing appends to the piece that was typed last
+			if(!piece->added || piece->start + piece->bytes != start ||
+				piece->bytes + bytes > MAX_PIECE_BYTES)
+			{
+				return false;
+			}
+
+			piece->bytes += bytes;
+			countPiece(piece);
+		}
+
+		update(piece);
+		return true;
+	}
+
+	void TextBuffer::destroy( Piece* piece ) const
+	{
+		if(!piece)
+		{
+			return;
+		}
+
+		destroy(piece->left);
+		destroy(piece->right);
+		delete piece;
+	}
+
+	void TextBuffer::appendPiece( const Piece* piece, int &skip,
+		int &length, std::string &out ) const
+	{
+		if(!piece || length <= 0)
+		{
+			return;
+		}
+
+		if(skip >= piece->totalChars)
+		{
+			skip -= piece->totalChars;
+			return;
+		}
+
+		appendPiece(piece->left,skip,length,out);
+
+		if(length <= 0)
+		{
+			return;
+		}
+
+		if(skip >= piece->chars)
+		{
+			skip -= piece->chars;
+		}
+		else
+		{
+			int count = piece->chars - skip;
+			if(count > length)
+			{
+				count = length;
+			}
+
+			size_t begin = getPieceByteOffset(piece,skip);
+			size_t end = getPieceByteOffset(piece,skip + count);
+			out.append(getPieceText(piece) + begin,end - begin);
+
+			length -= count;
+			skip = 0;
+		}
+
+		appendPiece(piece->right,skip,length,out);
+	}
+
+	bool TextBuffer::pieceContains( const Piece* piece, char c ) const
+	{
+		if(!piece)
+		{
+			return false;
+		}
+
+		if(memchr(getPieceText(piece),c,piece->bytes))
+		{
+			return true;
+		}
+
+		return pieceContains(piece->left,c) || pieceContains(piece->right,c);
+	}
+
+	void TextBuffer::appendPiecePrefixWidths( const Piece* piece,
+		const Font* font, std::vector<int> &widths ) const
+	{
+		if(!piece)
+		{
+			return;
+		}
+
+		appendPiecePrefixWidths(piece->left,font,widths);
+		font->appendPrefixWidths(getPieceText(piece),piece->bytes,widths);
+		appendPiecePrefixWidths(piece->right,font,widths);
+	}
+
+	void TextBuffer::flatten() const
+	{
+		std::string text;
+		text.reserve(getByteLength());
+
+		int skip = 0;
+		int length = getLength();
+		appendPiece(root,skip,length,text);
+
+		destroy(root);
+		original.swap(text);
+		added.clear();
+		root = createPieces(false,0,original.length());
+		flat = true;
+	}
+
+	void TextBuffer::setText( const std::string &text )
+	{
+		destroy(root);
+		original = text;
+		added.clear();
+		root = createPieces(false,0,original.length());
+		flat = true;
+	}
+
+	void TextBuffer::insert( int index, const std::string &text )
+	{
+		if(text.length() == 0)
+		{
+			return;
+		}
+
+		if(index < 0)
+		{
+			index = 0;
+		}
+		if(index > getLength())
+		{
+			index = getLength();
+		}
+
+		size_t start = added.length();
+		added += text;
+		flat = false;
+
+		Piece* left = NULL;
+		Piece* right = NULL;
+		split(root,index,left,right);
+
+		if(!extendLast(left,start,text.length()))
+		{
+			left = merge(left,createPieces(true,start,text.length()));
+		}
+
+		root = merge(left,right);
+
+		//erased insertions still occupy the added buffer
+		if(added.length() > MAX_PIECE_BYTES * 4 &&
+			added.length() > getByteLength() * 2)
+		{
+			flatten();
+		}
+	}
+
+	void TextBuffer::erase( int index, int length )
+	{
+		if(index < 0)
+		{
+			length += index;
+			index = 0;
+		}
+		if(index + length > getLength())
+		{
+			length = getLength() - index;
+		}
+		if(length <= 0)
+		{
+			return;
+		}
+
+		Piece* left = NULL;
+		Piece* middle = NULL;
+		Piece* right = NULL;
+		split(root,index,left,right);
+		split(right,length,middle,right);
+		destroy(middle);
+
+		root = merge(left,right);
+		flat = false;
+	}
+
+	int TextBuffer::getLength() const
+	{
+		return root ? root->totalChars : 0;
+	}
+
+	size_t TextBuffer::getByteLength() const
+	{
+		return root ? root->totalBytes : 0;
+	}
+
+	int TextBuffer::getLineCount() const
+	{
+		return root ? root->totalNewlines + 1 : 1;
+	}
+
+	int TextBuffer::getLineStart( int line ) const
+	{
+		if(line <= 0)
+		{
+			return 0;
+		}
+
+		const Piece* piece = root;
+		int index = 0;
+
+		while(piece)
+		{
+			int leftNewlines = piece->left ? piece->left->totalNewlines : 0;
+			int leftChars = piece->left ? piece->left->totalChars : 0;
+
+			if(line <= leftNewlines)
+			{
+				piece = piece->left;
+			}
+			else if(line <= leftNewlines + piece->newlines)
+			{
+				//find the newline inside of this piece
+				line -= leftNewlines;
+				index += leftChars;
+				const char* text = getPieceText(piece);
+
+				for(size_t i = 0; i < piece->bytes; ++i)
+				{
+					if(((unsigned char)text[i] & 0xC0) != 0x80)
+					{
+						index++;
+					}
+					if(text[i] == '\n')
+					{
+						line--;
+						if(line == 0)
+						{
+							return index;
+						}
+					}
+				}
+				return index;
+			}
+			else
+			{
+				line -= leftNewlines + piece->newlines;
+				index += leftChars + piece->chars;
+				piece = piece->right;
+			}
+		}
+
+		return getLength();
+	}
+
+	size_t TextBuffer::getByteOffset( int index ) const
+	{
+		const Piece* piece = root;
+		size_t offset = 0;
+
+		while(piece)
+		{
+			int leftChars = piece->left ? piece->left->totalChars : 0;
+			size_t leftBytes = piece->left ? piece->left->totalBytes : 0;
+
+			if(index < leftChars)
+			{
+				piece = piece->left;
+			}
+			else if(index < leftChars + piece->chars)
+			{
+				return offset + leftBytes + getPieceByteOffset(piece,index - leftChars);
+			}
+			else
+			{
+				index -= leftChars + piece->chars;
+				offset += leftBytes + piece->bytes;
+				piece = piece->right;
+			}
+		}
+
+		return offset;
+	}
+
+	std::string TextBuffer::getSubString( int index, int length ) const
+	{
+		std::string text;
+		if(index < 0)
+		{
+			length += index;
+			index = 0;
+		}
+
+		appendPiece(root,index,length,text);
+		return text;
+	}
+
+	bool TextBuffer::isNewline( int index ) const
+	{
+		const Piece* piece = root;
+
+		while(piece)
+		{
+			int leftChars = piece->left ? piece->left->totalChars : 0;
+
+			if(index < leftChars)
+			{
+				piece = piece->left;
+			}
+			else if(index < leftChars + piece->chars)
+			{
+				return getPieceText(piece)[getPieceByteOffset(piece,index - leftChars)] == '\n';
+			}
+			else
+			{
+				index -= leftChars + piece->chars;
+				piece = piece->right;
+			}
+		}
+
+		return false;
+	}
+
+	bool TextBuffer::contains( char c ) const
+	{
+		return pieceContains(root,c);
+	}
+
+	void TextBuffer::getPrefixWidths( const Font* font, std::vector<int> &widths ) const
+	{
+		widths.clear();
+		widths.reserve(getLength() + 1);
+		widths.push_back(0);
+		appendPiecePrefixWidths(root,font,widths);
+	}
+
+	const std::string& TextBuffer::getString() const
+	{
+		if(!flat)
+		{
+			flatten();
+		}
+
+		return original;
+	}
+}
@@ -39,6 +39,7 @@
  */
 
 #include "Agui/Widget.hpp"
+#include "Agui/SpatialIndex.hpp"
 #include <queue>
 
 namespace agui {
@@ -46,12 +47,14 @@ namespace agui {
 
 	Widget::Widget(void)
 	: font(getGlobalFont()),_container(NULL), _focusManager(NULL), parentWidget(NULL),
-	   usingGlobalFont(true),previousFontNum(678),
+	   usingGlobalFont(true),previousFontNum(globalFontID),
 	   isWidgetVisible(true),isWidgetEnabled(true),
 	   isWidgetFocusable(false),isWidgetTabable(false), paintingChildren(false),
 	   tMargin(1),lMargin(1),bMargin(1),rMargin(1), textLen(0),
 	   flaggedForDestruction(false),handlesChildLogic(false),prevTabable(true),
-	   layoutWidget(false)
+	   layoutWidget(false), childIndex(NULL), childIndexDirty(true),
+	   absPositionDirty(true), preferredSizeValid(false),
+	   preferredSizeFromSize(false), privateChild(false)
 	{
 		setLocation(Point(0,0));
 		setMargins(1,1,1,1);
@@ -104,17 +107,13 @@ namespace agui {
 			(*it)->_container = NULL;
 		}
 
+		delete childIndex;
 	}
 
 
 
 	void Widget::paint(const PaintEvent &paintEvent)
 	{
-		if(isUsingGlobalFont() && globalFontID != previousFontNum)
-		{
-			previousFontNum = globalFontID;
-			setFont(globalFont);
-		}
 		paintEvent.graphics()->setOffset(getAbsolutePosition());
 		paintBackground(paintEvent);
 
@@ -142,6 +141,8 @@ namespace agui {
 		}
 			this->text = text;
 			textLen = int(unicodeFunctions.length(getText()));
+			invalidatePreferredSize();
+			invalidate();
 
 	}
 
@@ -161,7 +162,8 @@ namespace agui {
 			return;
 		}
 
-		if(widget->parentWidget == NULL && !containsChildWidget(widget))
+		//a child always has a parent, so there is no need to search the children
+		if(widget->parentWidget == NULL)
 		{
 			for(std::vector<WidgetListener*>::iterator it =
 				widgetListeners.begin();
@@ -172,13 +174,21 @@ namespace agui {
 			}
 
 			children.push_back(widget);
+			childIndexDirty = true;
 
 			widget->parentWidget = this;
 			widget->_container = this->_container;
+			widget->_applyGlobalFont();
+			widget->invalidateAbsolutePosition();
 			widget->_parentSizeChangedEvent();
 			widget->parentSizeChanged();
 			if(getGui())
 			{
+				if(getGui()->_isWidgetRegistered(this))
+				{
+					getGui()->_registerWidget(widget);
+				}
+				widget->invalidate();
 				getGui()->_widgetLocationChanged();
 			}
 		}
@@ -207,7 +217,9 @@ namespace agui {
 		{
 			if(getGui())
 			{
+				widget->invalidate();
 				getGui()->_dispatchWidgetDestroyed(widget);
+				getGui()->_unregisterWidget(widget);
 			}
 
 
@@ -223,6 +235,7 @@ namespace agui {
 			WidgetArray::iterator i = children.begin();
 			std::advance(i,getChildWidgetIndex(widget));
 			children.erase(i);
+			childIndexDirty = true;
 
       widget->clearParentWidget();
 			widget->_container = NULL;
@@ -264,6 +277,8 @@ namespace agui {
   {
     this->checkLostFocusRecursive();
     this->parentWidget = NULL;
+    this->privateChild = false;
+    invalidateAbsolutePosition();
   }
 
 
@@ -364,32 +379,52 @@ namespace agui {
 
 	const Rectangle Widget::getAbsoluteRectangle() const
 	{
-		Point absLocation;
-
-		absLocation = getLocation();
+		return Rectangle(getCachedAbsolutePosition(),getSize());
+	}
 
-		if(!getParent())
+	const Point& Widget::getCachedAbsolutePosition() const
+	{
+		if(absPositionDirty)
 		{
-			return Rectangle(absLocation.getX(),absLocation.getY(),
-				getSize().getWidth(),getSize().getHeight());
+			absPosition = getLocation();
+
+			if(getParent())
+			{
+				const Point &parentPosition = 
+					getParent()->getCachedAbsolutePosition();
+
+				absPosition.setX(absPosition.getX() + parentPosition.getX() +
+					getParent()->getMargin(SIDE_LEFT));
+				absPosition.setY(absPosition.getY() + parentPosition.getY() +
+					getParent()->getMargin(SIDE_TOP));
+			}
+
+			absPositionDirty = false;
 		}
-		
-		const Widget* parent = this;
-		int eX = 0;
-		int eY = 0;
 
-		while(parent->getParent() != NULL)
+		return absPosition;
+	}
+
+	void Widget::invalidateAbsolutePosition()
+	{
+		if(absPositionDirty)
 		{
-			parent = parent->getParent();
+			return;
+		}
 
-			eX = parent->getMargin(SIDE_LEFT);
-			eY = parent->getMargin(SIDE_TOP);
-		
-			absLocation.setX(absLocation.getX() + parent->getLocation().getX() + eX);
-			absLocation.setY(absLocation.getY() + parent->getLocation().getY() + eY);
+		absPositionDirty = true;
+
+		for(WidgetArray::iterator it = privateChildren.begin();
+			it != privateChildren.end(); ++it)
+		{
+			(*it)->invalidateAbsolutePosition();
 		}
 
-		return Rectangle(absLocation,getSize());
+		for(WidgetArray::iterator it = children.begin();
+			it != children.end(); ++it)
+		{
+			(*it)->invalidateAbsolutePosition();
+		}
 	}
 
 	const Dimension& Widget::getSize() const
@@ -420,8 +455,20 @@ namespace agui {
 			y = minSize.getHeight();
 		}
 
+		invalidate();
 		this->size = Dimension(x,y);
 		_setInnerSize();
+		invalidate();
+
+		if(preferredSizeFromSize)
+		{
+			preferredSizeValid = false;
+		}
+
+		if(getParent())
+		{
+			getParent()->childIndexDirty = true;
+		}
 
 		if(getGui() && getGui()->getLockWidget() == NULL)
 		{
@@ -464,7 +511,15 @@ namespace agui {
 
 	void Widget::setLocation(const Point &location )
 	{
+		invalidate();
 		this->location = location;
+		invalidateAbsolutePosition();
+		invalidate();
+
+		if(getParent())
+		{
+			getParent()->childIndexDirty = true;
+		}
 
 		for(std::vector<WidgetListener*>::iterator it = 
 			widgetListeners.begin();
@@ -579,6 +634,7 @@ namespace agui {
 		if(visible != this->isWidgetVisible)
 		{
 			this->isWidgetVisible = visible;
+			invalidate();
 
 			for(std::vector<WidgetListener*>::iterator it = 
 				widgetListeners.begin();
@@ -664,6 +720,7 @@ namespace agui {
 		if(this->isWidgetEnabled != enabled)
 		{
 			this->isWidgetEnabled = enabled;
+			invalidate();
 
 			for(std::vector<WidgetListener*>::iterator it = 
 				widgetListeners.begin();
@@ -751,6 +808,67 @@ namespace agui {
 		return int(children.size());
 	}
 
+	void Widget::setChildIndexing( bool indexing )
+	{
+		if(indexing && !childIndex)
+		{
+			childIndex = new SpatialIndex();
+			childIndexDirty = true;
+		}
+		else if(!indexing && childIndex)
+		{
+			delete childIndex;
+			childIndex = NULL;
+		}
+	}
+
+	bool Widget::isChildIndexing() const
+	{
+		return childIndex != NULL;
+	}
+
+	void Widget::_getChildrenAt( const Point &p, WidgetArray &candidates )
+	{
+		candidates.clear();
+
+		if(!childIndex)
+		{
+			for(WidgetArray::iterator it = children.begin();
+				it != children.end(); ++it)
+			{
+				if(Rectangle((*it)->getLocation(),(*it)->getSize()).pointInside(p))
+				{
+					candidates.push_back(*it);
+				}
+			}
+			return;
+		}
+
+		//the children moved, resized or were reordered since the last query
+		if(childIndexDirty)
+		{
+			std::vector<Rectangle> rects;
+			rects.reserve(children.size());
+			for(WidgetArray::iterator it = children.begin();
+				it != children.end(); ++it)
+			{
+				rects.push_back(Rectangle((*it)->getLocation(),(*it)->getSize()));
+			}
+
+			childIndex->build(rects);
+			childIndexDirty = false;
+		}
+
+		std::vector<int> items;
+		childIndex->getItemsAt(p,items);
+
+		for(std::vector<int>::iterator it = items.begin();
+			it != items.end(); ++it)
+		{
+			candidates.push_back(children[*it]);
+		}
+	}
+
 	Gui* Widget::getGui() const
 	{
 
@@ -796,6 +914,7 @@ namespace agui {
 		}
 
 		minSize = Dimension(x,y);
+		invalidatePreferredSize();
 		setSize(getSize());
 
 		for(std::vector<WidgetListener*>::iterator it = 
@@ -834,6 +953,7 @@ namespace agui {
 		}
 
 		maxSize = Dimension(x,y);
+		invalidatePreferredSize();
 
 		setSize(getSize());
 
@@ -893,6 +1013,32 @@ namespace agui {
 		return globalFont;
 	}
 
+	int Widget::_getGlobalFontID()
+	{
+		return globalFontID;
+	}
+
+	void Widget::_applyGlobalFont()
+	{
+		if(isUsingGlobalFont() && globalFontID != previousFontNum)
+		{
+			previousFontNum = globalFontID;
+			setFont(globalFont);
+		}
+
+		for(WidgetArray::iterator it = privateChildren.begin();
+			it != privateChildren.end(); ++it)
+		{
+			(*it)->_applyGlobalFont();
+		}
+
+		for(WidgetArray::iterator it = children.begin();
+			it != children.end(); ++it)
+		{
+			(*it)->_applyGlobalFont();
+		}
+	}
+
 	void Widget::setFont( const Font *font )
 	{
 		if(font == globalFont)
@@ -905,6 +1051,9 @@ namespace agui {
 			usingGlobalFont = false;
 		}
 
+		invalidatePreferredSize();
+		invalidate();
+
 		for(std::vector<WidgetListener*>::iterator it = 
 			widgetListeners.begin();
 			it != widgetListeners.end(); ++it)
@@ -1135,6 +1284,7 @@ namespace agui {
 	void Widget::setFontColor( const Color &color )
 	{
 		fontColor = color;
+		invalidate();
 	}
 
 	const Color& Widget::getFontColor() const
@@ -1145,6 +1295,7 @@ namespace agui {
 	void Widget::setBackColor( const Color &color )
 	{
 		backColor = color;
+		invalidate();
 	}
 
 	const Color& Widget::getBackColor() const
@@ -1160,6 +1311,7 @@ namespace agui {
 			opacity = 0.0f;
 
 		this->opacity = opacity;
+		invalidate();
 	}
 
 	float Widget::getOpacity() const
@@ -1376,6 +1528,8 @@ namespace agui {
 
 
 			children.insert(children.begin(),widget);
+			childIndexDirty = true;
+			widget->invalidate();
 
 		}
 		else if(containsPrivateChild(widget))
@@ -1388,6 +1542,7 @@ namespace agui {
 
 
 			privateChildren.insert(privateChildren.begin(),widget);
+			widget->invalidate();
 		}
 	}
 
@@ -1403,6 +1558,8 @@ namespace agui {
 				children.end(), widget), children.end());
 
 			children.push_back(widget);
+			childIndexDirty = true;
+			widget->invalidate();
 
 		}
 		else if(containsPrivateChild(widget))
@@ -1414,6 +1571,7 @@ namespace agui {
 				privateChildren.end(), widget), privateChildren.end());
 
 			privateChildren.push_back(widget);
+			widget->invalidate();
 		}
 	}
 
@@ -1445,7 +1603,7 @@ namespace agui {
 
 	Point Widget::getAbsolutePosition() const
 	{
-		return getAbsoluteRectangle().getLeftTop();
+		return getCachedAbsolutePosition();
 	}
 
 	
@@ -1600,9 +1758,19 @@ namespace agui {
 			privateChildren.push_back(widget);
 
 			widget->parentWidget = this;
+			widget->privateChild = true;
 			widget->_container = this->_container;
+			widget->_applyGlobalFont();
+			widget->invalidateAbsolutePosition();
 			widget->_parentSizeChangedEvent();
 			widget->parentSizeChanged();
+
+			if(getGui() && getGui()->_isWidgetRegistered(this))
+			{
+				getGui()->_registerWidget(widget);
+			}
+
+			widget->invalidate();
 		}
 	}
 
@@ -1629,6 +1797,12 @@ namespace agui {
 
 		if(containsPrivateChild(widget))
 		{
+			if(getGui())
+			{
+				widget->invalidate();
+				getGui()->_unregisterWidget(widget);
+			}
+
 			WidgetArray::iterator i = privateChildren.begin();
 			std::advance(i,getPrivateChildIndex(widget));
 			privateChildren.erase(i);
@@ -1692,6 +1866,29 @@ namespace agui {
 		}
 	}
 
+	void Widget::dispatchTextChangedEvent()
+	{
+		for(std::vector<WidgetListener*>::iterator it = 
+			widgetListeners.begin();
+			it != widgetListeners.end(); ++it)
+		{
+			if((*it))
+				(*it)->textChanged(this,getText());
+		}
+	}
+
+	void Widget::dispatchTextEditedEvent( int index, int removedLength,
+		int insertedLength )
+	{
+		for(std::vector<WidgetListener*>::iterator it = 
+			widgetListeners.begin();
+			it != widgetListeners.end(); ++it)
+		{
+			if((*it))
+				(*it)->textEdited(this,index,removedLength,insertedLength);
+		}
+	}
+
 	const Rectangle Widget::getRelativeRectangle() const
 	{
 		return Rectangle(getLocation(),getSize());
@@ -1704,6 +1901,10 @@ namespace agui {
 
 	void Widget::setPaintingChildren( bool painting )
 	{
+		if(painting != paintingChildren)
+		{
+			invalidate();
+		}
 		paintingChildren = painting;
 	}
 
@@ -1752,6 +1953,15 @@ namespace agui {
 		}
 	}
 
+	void Widget::invalidate()
+	{
+		Gui* gui = getGui();
+		if(gui)
+		{
+			gui->invalidateRectangle(getAbsoluteRectangle());
+		}
+	}
+
 	void Widget::paintChildren(const PaintEvent &paintEvent )
 	{
 		stackOffset = paintEvent.graphics()->getOffset();
@@ -1762,6 +1972,36 @@ namespace agui {
 
 	void Widget::_recursivePaintChildren( Widget *root, bool enabled,
 										   Graphics *graphicsContext )
+	{
+		//nothing outside of the current clipping rectangle can be seen
+		Rectangle visible;
+		if(!graphicsContext->getClippingStack().empty())
+		{
+			visible = graphicsContext->getClippingStack().top();
+		}
+		else if(graphicsContext->isUsingBaseClippingRect())
+		{
+			visible = graphicsContext->getBaseClippingRect();
+		}
+		else
+		{
+			visible = Rectangle(Point(0,0),graphicsContext->getDisplaySize());
+		}
+
+		size_t stackSize = graphicsContext->getClippingRectCount();
+		graphicsContext->setOffset(Point(0,0));
+		graphicsContext->pushClippingRect(visible);
+
+		recursivePaintChildren(root,enabled,graphicsContext,visible);
+
+		while(graphicsContext->getClippingRectCount() > stackSize)
+		{
+			graphicsContext->popClippingRect();
+		}
+	}
+
+	void Widget::recursivePaintChildren( Widget *root, bool enabled,
+		Graphics *graphicsContext, const Rectangle &visible )
 	{
 		//recursively calls itself to render widgets from back to front
 
@@ -1777,31 +2017,69 @@ namespace agui {
 			widgetEnabled = false;
 		}
 
+		Rectangle absRect = root->getAbsoluteRectangle();
+
 		if(root != this)
 		{
-			root->clip(PaintEvent(widgetEnabled,graphicsContext));
+			//the widget and its children are clipped to this rectangle
+			if(!visible.intersects(absRect))
+			{
+				if(root->getGui())
+				{
+					root->getGui()->_widgetCulled();
+				}
+				return;
+			}
+
+			if(root->getGui())
+			{
+				root->getGui()->_widgetPainted();
+			}
+
+			/* the top of the clipping stack is the visible rectangle,
+			so the widget only needs to push its own rectangle */
+			size_t stackSize = graphicsContext->getClippingRectCount();
+			graphicsContext->setOffset(absRect.getLeftTop());
+			graphicsContext->pushClippingRect(root->getSizeRectangle());
 
 			root->paint(PaintEvent(widgetEnabled,graphicsContext));
 
+			while(graphicsContext->getClippingRectCount() > stackSize)
+			{
+				graphicsContext->popClippingRect();
+			}
+
 			if(root->isPaintingChildren())
 			{
 				return;
 			}
 		}
 
+		//children are clipped to the inner rectangle
+		Rectangle childVisible = visible.getIntersection(Rectangle(
+			absRect.getX() + root->getMargin(SIDE_LEFT),
+			absRect.getY() + root->getMargin(SIDE_TOP),
+			root->getInnerSize().getWidth(),root->getInnerSize().getHeight()));
+
+		graphicsContext->setOffset(Point(
+			absRect.getX() + root->getMargin(SIDE_LEFT),
+			absRect.getY() + root->getMargin(SIDE_TOP)));
+		graphicsContext->pushClippingRect(root->getInnerRectangle());
+
 		for(WidgetArray::iterator it = 
 			root->getPrivateChildBegin();
 			it != root->getPrivateChildEnd(); ++it)
 		{
-			_recursivePaintChildren(*it,widgetEnabled,graphicsContext);
+			recursivePaintChildren(*it,widgetEnabled,graphicsContext,childVisible);
 		}
 		for(WidgetArray::iterator it = 
 			root->getChildBegin();
 			it != root->getChildEnd(); ++it)
 		{
-			_recursivePaintChildren(*it,widgetEnabled,graphicsContext);
+			recursivePaintChildren(*it,widgetEnabled,graphicsContext,childVisible);
 		}
 
+		graphicsContext->popClippingRect();
 	}
 
 	const Rectangle Widget::getSizeRectangle() const
@@ -1826,6 +2104,21 @@ namespace agui {
 		bMargin = b;
 		rMargin = r;
 		_setInnerSize();
+		invalidatePreferredSize();
+
+		for(WidgetArray::iterator it = privateChildren.begin();
+			it != privateChildren.end(); ++it)
+		{
+			(*it)->invalidateAbsolutePosition();
+		}
+
+		for(WidgetArray::iterator it = children.begin();
+			it != children.end(); ++it)
+		{
+			(*it)->invalidateAbsolutePosition();
+		}
+
+		invalidate();
 	}
 
 	int Widget::getMargin( SideEnum side ) const
@@ -2061,6 +2354,15 @@ namespace agui {
 		layoutWidget = layout;
 	}
 
+	void Widget::_flushLayout()
+	{
+	}
+
+	bool Widget::_isPrivateChild() const
+	{
+		return privateChild;
+	}
+
 	bool Widget::isLayout() const
 	{
 		return layoutWidget;
@@ -2071,6 +2373,38 @@ namespace agui {
 
   }
 
+	const Dimension& Widget::getPreferredSize()
+	{
+		if(!preferredSizeValid)
+		{
+			//set back to true by the default measure
+			preferredSizeFromSize = false;
+			preferredSize = computePreferredSize();
+			preferredSizeValid = true;
+		}
+
+		return preferredSize;
+	}
+
+	void Widget::invalidatePreferredSize()
+	{
+		preferredSizeValid = false;
+
+		//an invalid parent has not been measured since, nor have its parents
+		Widget* parent = getParent();
+		while(parent && parent->preferredSizeValid)
+		{
+			parent->preferredSizeValid = false;
+			parent = parent->getParent();
+		}
+	}
+
+	Dimension Widget::computePreferredSize()
+	{
+		preferredSizeFromSize = true;
+		return getSize();
+	}
+
   void Widget::resizeToContentsRecursiveUp()
   {
     this->resizeToContents();
@@ -39,9 +39,17 @@
  */
 
 #include "Agui/WidgetListener.hpp"
+#include "Agui/Widget.hpp"
 namespace agui {
 	WidgetListener::WidgetListener(void)
 	{
 	}
 
+	void WidgetListener::textEdited( Widget* source, int index,
+		int removedLength, int insertedLength )
+	{
+		(void)index; (void)removedLength; (void)insertedLength;
+		textChanged(source,source->getText());
+	}
+
 }
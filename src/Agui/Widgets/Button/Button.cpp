@@ -80,6 +80,7 @@ namespace agui {
 				(*it)->textAlignmentChanged(this,alignment);
 		}
 		this->textAlignment = alignment;
+		invalidate();
 	}
 
 	AreaAlignmentEnum Button::getTextAlignment() const
@@ -98,6 +99,10 @@ namespace agui {
 			if((*it))
 				(*it)->buttonStateChanged(this,state);
 		}
+		if(state != buttonState)
+		{
+			invalidate();
+		}
 		buttonState = state;
 	}
 
@@ -108,9 +113,10 @@ namespace agui {
 
 	void Button::paintComponent( const PaintEvent &paintEvent )
 	{
-
-		resizableText.drawTextArea(paintEvent.graphics(),getFont(),
-			getInnerRectangle(),getFontColor(),wrappedText,getTextAlignment());
+		resizableText.drawShapedText(paintEvent.graphics(),
+			getInnerRectangle(),getFontColor(),
+			resizableText.shapeText(getFont(),getText(),
+			getInnerWidth(),getTextAlignment()));
 	}
 
 	void Button::modifyButtonState()
@@ -224,6 +230,7 @@ namespace agui {
 			return;
 		}
 		this->toggled = toggled;
+		invalidate();
 
 		for(std::vector<ButtonListener*>::iterator it = 
 			buttonListeners.begin();
@@ -238,14 +245,11 @@ namespace agui {
 	void Button::setText( const std::string &text )
 	{
 		Widget::setText(text);
-		resizableText.makeTextLines(getFont(),getText(),wrappedText,getInnerWidth());
 	}
 
 	void Button::setSize( const Dimension &size )
 	{
 		Widget::setSize(size);
-		resizableText.makeTextLines(getFont(),getText(),wrappedText,getInnerWidth());
-
 	}
 
 	void Button::setSize( int width, int height )
@@ -256,7 +260,7 @@ namespace agui {
 	void Button::setFont( const Font *font )
 	{
 		Widget::setFont(font);
-		resizableText.makeTextLines(getFont(),getText(),wrappedText,getInnerWidth());
+		resizableText.invalidateShapedText();
 	}
 
 	void Button::focusGained()
@@ -422,7 +426,8 @@ namespace agui {
 
 	const std::vector<std::string>& Button::getAreaText() const
 	{
-		return wrappedText;
+		return resizableText.shapeText(getFont(),getText(),
+			getInnerWidth(),getTextAlignment()).getLines();
 	}
 
 	void Button::setToggleState(bool toggled)
@@ -435,14 +440,18 @@ namespace agui {
 	}
 
 	void Button::resizeToContents()
+	{
+		setSize(getPreferredSize());
+	}
+
+	Dimension Button::computePreferredSize()
 	{
 		int w = getFont()->getTextWidth(getText()) +
 			getMargin(SIDE_LEFT) + getMargin(SIDE_RIGHT);
 		int h = getFont()->getLineHeight() +
 			getMargin(SIDE_TOP) + getMargin(SIDE_BOTTOM);
 
-		setSize(w,h);
-		
+		return Dimension(w,h);
 	}
 
 	void Button::setButtonState( ButtonStateEnum state )
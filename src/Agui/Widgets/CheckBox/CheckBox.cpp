@@ -71,6 +71,7 @@ namespace agui {
 	void CheckBox::setCheckBoxSize( const Dimension &size )
 	{
 		checkBoxSize = size;
+		invalidatePreferredSize();
 		positionCheckBox();
 		if(isAutosizing())
 		{
@@ -85,6 +86,10 @@ namespace agui {
 
 	void CheckBox::changeCheckBoxState( CheckBoxStateEnum state )
 	{
+		if(state != checkBoxState)
+		{
+			invalidate();
+		}
 		checkBoxState = state;
 
 		for(std::vector<CheckBoxListener*>::iterator it = 
@@ -149,6 +154,10 @@ namespace agui {
 
 	void CheckBox::changeCheckedState( CheckBoxCheckedEnum state )
 	{
+		if(state != checkedState)
+		{
+			invalidate();
+		}
 		checkedState = state;
 
 		for(std::vector<CheckBoxListener*>::iterator it = 
@@ -214,6 +223,7 @@ namespace agui {
 	void CheckBox::setCheckBoxAlignment( AreaAlignmentEnum alignment )
 	{
 		checkBoxAlignment = alignment;
+		invalidatePreferredSize();
 		resizeCaption();
 		positionCheckBox();
 		if(isAutosizing())
@@ -269,6 +279,7 @@ namespace agui {
 			getCheckBoxAlignment(),getInnerRectangle(),
 			getCheckBoxSize());
 		checkBoxRect = Rectangle(checkBoxPosition,checkBoxSize);
+		invalidate();
 	}
 
 
@@ -334,11 +345,19 @@ namespace agui {
 	void CheckBox::resizeToContents()
 	{
 		positionCheckBox();
+		_setSizeInternal(getPreferredSize());
 
+		if(getText().length() != 0)
+		{
+			resizeCaption();
+		}
+	}
+
+	Dimension CheckBox::computePreferredSize()
+	{
 		if(getText().length() == 0)
 		{
-			_setSizeInternal(getCheckBoxSize());
-			return;
+			return getCheckBoxSize();
 		}
 		
 		int sizeX = getFont()->getTextWidth(getText());
@@ -366,16 +385,12 @@ namespace agui {
 			break;
 		}
 
-		_setSizeInternal(Dimension(sizeX + 
+		return Dimension(sizeX + 
 			getMargin(SIDE_LEFT) + 
 			getMargin(SIDE_RIGHT),
 			sizeY + 
 			getMargin(SIDE_TOP) +
-			getMargin(SIDE_BOTTOM))
-			);
-		resizeCaption();
-
-
+			getMargin(SIDE_BOTTOM));
 	}
 
 
@@ -618,6 +633,7 @@ namespace agui {
 	void CheckBox::setSidePadding(int padding) 
 	{
 		sidePadding = padding;
+		invalidatePreferredSize();
 
 		positionCheckBox();
 		if(isAutosizing())
@@ -179,6 +179,7 @@ namespace agui {
 			pChildListBox->moveToSelection(getSelectedIndex());
 		}
 		pChildListBox->requestModalFocus();
+		invalidate();
 
 		for(std::vector<DropDownListener*>::iterator it = 
 			dropDownListeners.begin();
@@ -198,6 +199,7 @@ namespace agui {
 		}
 		pChildListBox->releaseModalFocus();
 		focus();
+		invalidate();
 
 		for(std::vector<DropDownListener*>::iterator it = 
 			dropDownListeners.begin();
@@ -161,6 +161,7 @@ namespace agui {
 		pChildContainer->setSize(
 			getInnerSize().getWidth() - getRightMargin() - getLeftMargin(),
 			getInnerSize().getHeight() - getBottomMargin() - getTopMargin());
+		invalidate();
 	}
 
 	void Frame::setSize( const Dimension &size )
@@ -512,11 +513,13 @@ namespace agui {
   void Frame::setFrontColor(const Color& color)
   {
     this->frontColor = color;
+    invalidate();
   }
 
   void Frame::resizeToContents()
   {
     topMargin = getFont()->getLineHeight() + titleFontMargin;
+    invalidate();
   }
   void Frame::setTitleFontMargin(int margin)
   {
@@ -66,6 +66,7 @@ namespace agui {
       this->setSize(image->getWidth(), image->getHeight());
       this->setMargins(topMargin, leftMargin, rightMargin, bottomMargin);
     }
+    invalidate();
   }
 
 	int ImageWidget::getTopMargin() const
@@ -108,24 +109,28 @@ namespace agui {
 	{
 		if(margin >= 0)
 			topMargin = margin;
+		invalidate();
 	}
 
 	void ImageWidget::setLeftMargin( int margin )
 	{
 		if(margin >= 0)
 			leftMargin = margin;
+		invalidate();
 	}
 
 	void ImageWidget::setBottomMargin( int margin )
 	{
 		if(margin >= 0)
 			bottomMargin = margin;
+		invalidate();
 	}
 
 	void ImageWidget::setRightMargin( int margin )
 	{
 		if(margin >= 0)
 			rightMargin = margin;
+		invalidate();
 	}
 
 	void ImageWidget::setMargins( int t, int l, int b, int r )
@@ -76,8 +76,9 @@ namespace agui {
 
 	void Label::updateLabel()
 	{
-		resizableText.makeTextLines(getFont(),getText(),lines,
-			getInnerRectangle().getWidth());
+		resizableText.shapeText(getFont(),getText(),
+			getInnerRectangle().getWidth(),getAlignment());
+		invalidate();
 	}
 
 
@@ -106,11 +107,22 @@ namespace agui {
 	}
 
 	void Label::resizeToContents()
+	{
+		_setSizeInternal(getPreferredSize());
+	}
+
+	Dimension Label::computePreferredSize()
 	{
     double computedWidth = getFont()->getTextWidth(getText()) + getMargin(SIDE_LEFT) + getMargin(SIDE_RIGHT);
     if (this->getMaxSize().getWidth() > computedWidth)
       computedWidth = this->getMaxSize().getWidth();
-		_setSizeInternal(Dimension(int(computedWidth), getFont()->getLineHeight() * getNumTextLines() + getMargin(SIDE_TOP) + getMargin(SIDE_BOTTOM)));
+
+		//the lines are made at the new width, not the current one
+		std::vector<std::string> textLines;
+		resizableText.makeTextLines(getFont(),getText(),textLines,
+			int(computedWidth) - getMargin(SIDE_LEFT) - getMargin(SIDE_RIGHT));
+
+		return Dimension(int(computedWidth), getFont()->getLineHeight() * int(textLines.size()) + getMargin(SIDE_TOP) + getMargin(SIDE_BOTTOM));
 	}
 
   void Label::resizeToContentsPreserveWidth()
@@ -146,6 +158,7 @@ namespace agui {
 		{
 			setSize(size);
 			Widget::setSize(size);
+			updateLabel();
 		}
 		else
 		{
@@ -156,8 +169,8 @@ namespace agui {
 	void Label::drawText( const PaintEvent &paintEvent )
 	{
 		paintEvent.graphics()->pushClippingRect(getInnerRectangle());
-		resizableText.drawTextArea(paintEvent.graphics(),
-			getFont(),getInnerRectangle(),getFontColor(),lines,getAlignment());
+		resizableText.drawShapedText(paintEvent.graphics(),
+			getInnerRectangle(),getFontColor(),resizableText.getShapedText());
 		paintEvent.graphics()->popClippingRect();
 
 	}
@@ -213,6 +226,7 @@ namespace agui {
 	void Label::setFont( const Font *font )
 	{
 		Widget::setFont(font);
+		resizableText.invalidateShapedText();
 		if(isAutosizing())
 		{
 			resizeToContents();
@@ -220,6 +234,12 @@ namespace agui {
 		updateLabel();
 	}
 
+	void Label::setMargins( int t, int l, int b, int r )
+	{
+		Widget::setMargins(t,l,b,r);
+		updateLabel();
+	}
+
 	void Label::paintBackground( const PaintEvent &)
 	{
 
@@ -228,6 +248,8 @@ namespace agui {
 	void Label::setSingleLine( bool singleLine, bool wantEllipsis /*= false*/ )
 	{
 		resizableText.setSingleLine(singleLine,wantEllipsis);
+		invalidatePreferredSize();
+		updateLabel();
 	}
 
 	bool Label::wantsEllipsis() const
@@ -242,12 +264,12 @@ namespace agui {
 
 	int Label::getNumTextLines() const
 	{
-		return int(lines.size());
+		return resizableText.getShapedText().getLineCount();
 	}
 
-	std::vector<std::string>& Label::getTextLines()
+	const std::vector<std::string>& Label::getTextLines() const
 	{
-		return lines;
+		return resizableText.getShapedText().getLines();
 	}
 
 }
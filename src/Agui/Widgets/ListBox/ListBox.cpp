@@ -63,7 +63,9 @@ namespace agui {
 	: sorted(false), rsorted(false), verticalOffset(0),
 	horizontalOffset(0), lastMouseY(-1), hoveredIndex(-1),hoverSelection(false),
 	firstSelIndex(-1),lastSelIndex(-1), multiselect(false), multiselectExtended(false), itemHeight(0),
-	widestItem(0), wrapping(false), allowRightClick(false)
+	widestItem(0), wrapping(false), allowRightClick(false), updateDepth(0),
+	model(NULL), modelItem("",Color()), selectionDirty(false),
+	selectionFlagsStale(false), rangeSelectionEvents(false)
 	{
 		if(hScroll)
 		{
@@ -151,6 +153,11 @@ namespace agui {
 
 	void ListBox::removeItem( const std::string &item )
 	{
+		if(model)
+		{
+			return;
+		}
+
 		int selIndex = getSelectedIndex();
 		//remove first occurrence of item
 		for(ListItem::iterator it = items.begin();
@@ -158,6 +165,8 @@ namespace agui {
 		{
 			if(it->first.text == item)
 			{
+				removeItemWidth(item);
+				shiftSelectionRanges(int(it - items.begin()),-1);
 				items.erase(it);
 
 				for(std::vector<ListBoxListener*>::iterator it = listboxListeners.begin();
@@ -166,17 +175,7 @@ namespace agui {
 					(*it)->itemRemoved(this,item);
 				}
 
-				if(isSorted())
-				{
-					sort();
-				}
-				setWidestItem();
-				updateScrollBars();
-				setHoverIndex(getIndexAtPoint(agui::Point(getWidth() / 2,lastMouseY)));
-				if(isHoverSelection())
-				{
-					setSelectedIndex(hoveredIndex);
-				}
+				itemsChanged();
 				return;
 			}
 		}
@@ -184,37 +183,34 @@ namespace agui {
 		if(getSelectedIndex() != selIndex)
 		{
 			displatchSelectionEvent(getSelectedIndex(),
-				items[getSelectedIndex()].second);
+				isIndexSelected(getSelectedIndex()));
 		}
 	}
 
 	int ListBox::getLength() const
 	{
+		if(model)
+		{
+			return model->getItemCount();
+		}
+
 		return int(items.size());
 	}
 
 	void ListBox::addItemAt( const std::string &item, int index )
 	{
+		if(model)
+		{
+			return;
+		}
+
 		if(indexExists(index) || index == getLength())
 		{
+			shiftSelectionRanges(index,1);
 			items.insert(items.begin() + index,std::pair<ListBoxItem,bool>(ListBoxItem(
 				item,newItemColor),false));
-			if(isSorted())
-			{
-				sort();
-			}
-			int iWidth = getFont()->getTextWidth(item);
-			if(iWidth > widestItem)
-			{
-				widestItem = iWidth;
-			}
-			setWidestItem();
-			updateScrollBars();
-			setHoverIndex(getIndexAtPoint(agui::Point(getWidth() / 2,lastMouseY)));
-			if(isHoverSelection())
-			{
-				setSelectedIndex(hoveredIndex);
-			}
+			addItemWidth(item);
+			itemsChanged();
 			for(std::vector<ListBoxListener*>::iterator it = listboxListeners.begin();
 				it != listboxListeners.end(); ++it)
 			{
@@ -225,11 +221,16 @@ namespace agui {
 
 	bool ListBox::indexExists( int index ) const
 	{
-		return index >= 0 && index < (int)items.size();
+		return index >= 0 && index < getLength();
 	}
 
 	void ListBox::removeItemAt( int index )
 	{
+		if(model)
+		{
+			return;
+		}
+
 		if(indexExists(index))
 		{
 			for(std::vector<ListBoxListener*>::iterator it = listboxListeners.begin();
@@ -238,24 +239,30 @@ namespace agui {
 				(*it)->itemRemoved(this,items[index].first.text);
 			}
 
+			removeItemWidth(items[index].first.text);
+			shiftSelectionRanges(index,-1);
 			items.erase(items.begin() + index);
 
-			if(isSorted())
-			{
-				sort();
-			}
-			setWidestItem();
-			updateScrollBars();
-			setHoverIndex(getIndexAtPoint(agui::Point(getWidth() / 2,lastMouseY)));
-			if(isHoverSelection())
-			{
-				setSelectedIndex(hoveredIndex);
-			}
+			itemsChanged();
 		}
 	}
 
 	int ListBox::getIndexOf( const std::string &item ) const
 	{
+		if(model)
+		{
+			int count = getLength();
+			for(int i = 0; i < count; ++i)
+			{
+				if(getItemAt(i) == item)
+				{
+					return i;
+				}
+			}
+
+			return -1;
+		}
+
 		int count = 0;
 		//return first occurrence of item
 		for(ListItem::const_iterator it = items.begin();
@@ -273,22 +280,14 @@ namespace agui {
 
 	int ListBox::getSelectedIndex() const
 	{
-		int count = 0;
-		//finds the first selected index
-		if(!items.empty())
+		updateSelectionRanges();
+
+		if(selectedRanges.empty())
 		{
-			for(ListItem::const_iterator it = items.begin();
-				it != items.end(); ++it)
-			{
-				if(it->second)
-				{
-					return count;
-				}
-				
-				count++;
-			}
+			return -1;
 		}
-		return -1;
+
+		return selectedRanges.begin()->first;
 	}
 
 	void ListBox::setSelectedIndex( int index )
@@ -309,7 +308,7 @@ namespace agui {
 			{
 				firstSelIndex = index;
 				lastSelIndex = index;
-				items[index].second = true;
+				setIndexSelected(index,true);
 			}
 
 			
@@ -320,32 +319,40 @@ namespace agui {
 
 	void ListBox::clearItems()
 	{
+		if(model)
+		{
+			return;
+		}
+
 		if(getSelectedIndex() != -1)
 		{
 			displatchSelectionEvent(-1,false);
 		}
 		
 		items.clear();
-		setWidestItem();
-		updateScrollBars();
+		selectedRanges.clear();
+		selectionDirty = false;
+		selectionFlagsStale = false;
+		itemWidths.clear();
+		widestItem = 0;
+		if(!isUpdating())
+		{
+			updateScrollBars();
+		}
 	}
 
 	std::vector<int> ListBox::getSelectedIndexes() const
 	{
+		updateSelectionRanges();
+
 		std::vector<int> indexes;
-		if(items.empty())
+		for(std::map<int,int>::const_iterator it = selectedRanges.begin();
+			it != selectedRanges.end(); ++it)
 		{
-			return indexes;
-		}
-		int count = 0;
-		for(ListItem::const_iterator it = items.begin();
-			it != items.end(); ++it)
-		{
-			if(it->second)
+			for(int i = it->first; i < it->second; ++i)
 			{
-				indexes.push_back(count);
+				indexes.push_back(i);
 			}
-			count++;
 		}
 		return indexes;
 	}
@@ -364,18 +371,35 @@ namespace agui {
 		{
 			if(indexExists(indexes[0]) )
 			{
-				items[indexes[0]].second = true;
+				setIndexSelected(indexes[0],true);
 				displatchSelectionEvent(indexes[0],true);
 			}
 
 			return;
 		}
+		if(isRangeSelectionEvents())
+		{
+			for(std::vector<int>::const_iterator it = indexes.begin();
+				it != indexes.end(); ++it)
+			{
+				setIndexSelected(*it,true);
+			}
+
+			//one event per run of selected items
+			for(std::map<int,int>::const_iterator it = selectedRanges.begin();
+				it != selectedRanges.end(); ++it)
+			{
+				dispatchSelectionRangeEvent(it->first,it->second,true);
+			}
+			return;
+		}
+
 		for(std::vector<int>::const_iterator it = indexes.begin();
 			it != indexes.end(); ++it)
 		{
 			if(indexExists(*it) )
 			{
-				items[*it].second = true;
+				setIndexSelected(*it,true);
 				displatchSelectionEvent(*it,true);
 			}
 		}
@@ -384,17 +408,27 @@ namespace agui {
 
 	void ListBox::clearSelectedIndexes()
 	{
-		for(ListItem::iterator it = items.begin();
-			it != items.end(); ++it)
+		updateSelectionRanges();
+
+		if(!selectedRanges.empty())
 		{
-			it->second = false;
+			invalidate();
 		}
+		selectedRanges.clear();
+		selectionFlagsStale = true;
 
 		displatchSelectionEvent(-1,false);
 	}
 
 	void ListBox::sort()
 	{
+		//the model decides the order of its items
+		if(model)
+		{
+			return;
+		}
+
+		invalidate();
 		if(!isReverseSorted())
 		std::sort(getItemsBegin(),getItemsEnd(),LBCompare());
 		else
@@ -419,16 +453,32 @@ namespace agui {
 		int diff = getItemHeight() - getFont()->getLineHeight();
 
 		Color inverseFont = Color(255,255,255);
+		Color itemColor;
+		std::string modelText;
+		const std::string *text;
 
 		Color * color;
-		for(ListItem::const_iterator it = items.begin() + itemsSkipped ;
-			it != items.end(); ++it)
+		for(int i = itemsSkipped; i < getLength(); ++i)
 		{
 			if(rcount == maxitems)
 			{
 				break;
 			}
-			if(it->second)
+
+			//only the visible items are requested from the model
+			if(model)
+			{
+				modelText = model->getItemText(i);
+				text = &modelText;
+				itemColor = model->getItemColor(i,getNewItemColor());
+			}
+			else
+			{
+				text = &items[i].first.text;
+				itemColor = items[i].first.color;
+			}
+
+			if(isIndexSelected(i))
 			{
 				paintEvent.graphics()->drawFilledRectangle(Rectangle(Point
 					(0,h + verticalOffset),
@@ -436,20 +486,20 @@ namespace agui {
 
 				color = &inverseFont;
 			}
-			else if(itemsSkipped + rcount == getHoverIndex())
+			else if(i == getHoverIndex())
 			{
 				paintEvent.graphics()->drawFilledRectangle(Rectangle(Point
 					(0,h + verticalOffset),
 					Dimension(getInnerSize().getWidth(),getItemHeight())),Color(194,217,239));
 
-				color = (Color*)&it->first.color;
+				color = &itemColor;
 			}
 			else
 			{
-				color = (Color*)&it->first.color;
+				color = &itemColor;
 			}
 			paintEvent.graphics()->drawText(Point(horizontalOffset,
-				h + verticalOffset + (diff / 2)),it->first.text.c_str(),*color,
+				h + verticalOffset + (diff / 2)),text->c_str(),*color,
 				getFont());
 
 
@@ -504,41 +554,54 @@ namespace agui {
 
 	ListItem::iterator ListBox::getItemsBegin()
 	{
+		//the items may be reordered or selected through the iterator
+		updateSelectionFlags();
+		selectionDirty = true;
 		return items.begin();
 	}
 
 	ListItem::const_iterator ListBox::getItemsBegin() const
 	{
+		updateSelectionFlags();
 		return items.begin();
 	}
 
 	ListItem::iterator ListBox::getItemsEnd()
 	{
+		updateSelectionFlags();
+		selectionDirty = true;
 		return items.end();
 	}
 
 	ListItem ::const_iterator ListBox::getItemsEnd() const
 	{
+		updateSelectionFlags();
 		return items.end();
 	}
 
 	ListItem::reverse_iterator ListBox::getItemsRBegin()
 	{
+		updateSelectionFlags();
+		selectionDirty = true;
 		return items.rbegin();
 	}
 
 	ListItem::const_reverse_iterator ListBox::getItemsRBegin() const
 	{
+		updateSelectionFlags();
 		return items.rbegin();
 	}
 
 	ListItem::reverse_iterator ListBox::getItemsREnd()
 	{
+		updateSelectionFlags();
+		selectionDirty = true;
 		return items.rend();
 	}
 
 	ListItem ::const_reverse_iterator ListBox::getItemsREnd() const
 	{
+		updateSelectionFlags();
 		return items.rend();
 	}
 
@@ -825,12 +888,14 @@ namespace agui {
 	{
 		(void)source;
 		horizontalOffset = -val;
+		invalidate();
 	}
 
 	void ListBox::valueChanged( VScrollBar* source,int val )
 	{
 		(void)source;
 		verticalOffset = -val;
+		invalidate();
 	}
 
 
@@ -1090,8 +1155,8 @@ namespace agui {
 
 		if(isMultiselect())
 		{
-			items[selection].second = !items[selection].second;
-			if(items[selection].second)
+			setIndexSelected(selection,!isIndexSelected(selection));
+			if(isIndexSelected(selection))
 			{
 				firstSelIndex = selection;
 				lastSelIndex = selection;
@@ -1101,7 +1166,7 @@ namespace agui {
 				firstSelIndex = -1;
 				lastSelIndex = -1;
 			}
-			displatchSelectionEvent(selection,items[selection].second);
+			displatchSelectionEvent(selection,isIndexSelected(selection));
 		}
 		else if(isMultiselectExtended())
 		{
@@ -1119,8 +1184,8 @@ namespace agui {
 			}
 			else if(controlKey)
 			{
-				items[selection].second = !items[selection].second;
-				if(items[selection].second)
+				setIndexSelected(selection,!isIndexSelected(selection));
+				if(isIndexSelected(selection))
 				{
 					firstSelIndex = selection;
 					lastSelIndex = selection;
@@ -1130,7 +1195,7 @@ namespace agui {
 					firstSelIndex = -1;
 					lastSelIndex = -1;
 				}
-				displatchSelectionEvent(selection,items[selection].second);
+				displatchSelectionEvent(selection,isIndexSelected(selection));
 
 			}
 			else
@@ -1179,6 +1244,7 @@ namespace agui {
 		{
 			return;
 		}
+		invalidate();
 		for(std::vector<ListBoxListener*>::iterator it = listboxListeners.begin();
 			it != listboxListeners.end(); ++it)
 		{
@@ -1216,6 +1282,7 @@ namespace agui {
 					this->items.push_back(
 						std::pair<ListBoxItem,bool>(
 						ListBoxItem(items.substr(curpos,len),newItemColor),false));
+					addItemWidth(this->items.back().first.text);
 					
 					for(std::vector<ListBoxListener*>::iterator it = listboxListeners.begin();
 						it != listboxListeners.end(); ++it)
@@ -1239,38 +1306,21 @@ namespace agui {
 			this->items.push_back(
 				std::pair<ListBoxItem,bool>(ListBoxItem(
 				items.substr(curpos,len),newItemColor),false));
-
-			int iWidth = getFont()->getTextWidth(this->items.back().first.text);
-			if(iWidth > widestItem)
-			{
-				widestItem = iWidth;
-			}
+			addItemWidth(this->items.back().first.text);
 		}
 
-		if(isSorted())
-		{
-			sort();
-		}
-		setWidestItem();
-		updateScrollBars();
-		setHoverIndex(getIndexAtPoint(agui::Point(getWidth() / 2,lastMouseY)));
-		if(isHoverSelection())
-		{
-			setSelectedIndex(hoveredIndex);
-		}
+		itemsChanged();
 	}
 
 	void ListBox::addItems( const std::vector<std::string> &items )
 	{
+		this->items.reserve(this->items.size() + items.size());
+
 		for(std::vector<std::string>::const_iterator it = items.begin();
 			it != items.end(); ++it)
 		{
 			this->items.push_back(std::pair<ListBoxItem,bool>(ListBoxItem(*it,newItemColor),false));
-			int iWidth = getFont()->getTextWidth(*it);
-			if(iWidth > widestItem)
-			{
-				widestItem = iWidth;
-			}
+			addItemWidth(*it);
 
 			for(std::vector<ListBoxListener*>::iterator iter = listboxListeners.begin();
 				iter != listboxListeners.end(); ++iter)
@@ -1280,18 +1330,7 @@ namespace agui {
 			
 		}
 
-		if(isSorted())
-		{
-			sort();
-		}
-
-		setWidestItem();
-		updateScrollBars();
-		setHoverIndex(getIndexAtPoint(agui::Point(getWidth() / 2,lastMouseY)));
-		if(isHoverSelection())
-		{
-			setSelectedIndex(hoveredIndex);
-		}
+		itemsChanged();
 	}
 
 	void ListBox::moveToSelection(int selection)
@@ -1333,6 +1372,10 @@ namespace agui {
 		{
 			return std::string("");
 		}
+		else if(model)
+		{
+			return model->getItemText(index);
+		}
 		else
 		{
 			return items[index].first.text;
@@ -1361,26 +1404,394 @@ namespace agui {
 
 	void ListBox::setWidestItem()
 	{
-		if(getLength() == 0)
+		itemWidths.clear();
+		widestItem = 0;
+
+		if(model)
+		{
+			widestItem = model->getWidestItem(getFont());
+			return;
+		}
+
+		for(ListItem::const_iterator it = items.begin();
+			it != items.end(); ++it)
+		{
+			addItemWidth(it->first.text);
+		}
+	}
+
+	void ListBox::addItemWidth( const std::string &text )
+	{
+		int w = getFont()->getTextAdvance(text);
+		itemWidths[w]++;
+
+		if(w > widestItem)
+		{
+			widestItem = w;
+		}
+	}
+
+	void ListBox::removeItemWidth( const std::string &text )
+	{
+		std::map<int,int>::iterator it =
+			itemWidths.find(getFont()->getTextAdvance(text));
+
+		if(it != itemWidths.end())
+		{
+			it->second--;
+			if(it->second == 0)
+			{
+				itemWidths.erase(it);
+			}
+		}
+
+		if(itemWidths.empty())
 		{
 			widestItem = 0;
+		}
+		else
+		{
+			widestItem = itemWidths.rbegin()->first;
+		}
+	}
+
+	void ListBox::itemsChanged()
+	{
+		if(isUpdating())
+		{
+			return;
+		}
+
+		invalidate();
+		if(isSorted())
+		{
+			sort();
+		}
+		updateScrollBars();
+		setHoverIndex(getIndexAtPoint(agui::Point(getWidth() / 2,lastMouseY)));
+		if(isHoverSelection())
+		{
+			setSelectedIndex(hoveredIndex);
+		}
+	}
+
+	void ListBox::beginUpdate()
+	{
+		updateDepth++;
+	}
+
+	void ListBox::endUpdate()
+	{
+		if(updateDepth == 0)
+		{
+			return;
+		}
+
+		updateDepth--;
+		itemsChanged();
+	}
+
+	bool ListBox::isUpdating() const
+	{
+		return updateDepth > 0;
+	}
+
+	void ListBox::setModel( ListBoxModel *model )
+	{
+		//dispatches the -1 selection event
+		clearSelectedIndexes();
+		firstSelIndex = -1;
+		lastSelIndex = -1;
+
+		this->model = model;
+		modelChanged();
+	}
+
+	ListBoxModel* ListBox::getModel() const
+	{
+		return model;
+	}
+
+	void ListBox::modelChanged()
+	{
+		if(model)
+		{
+			//forget the selected items that no longer exist
+			int count = model->getItemCount();
+			while(!selectedRanges.empty() &&
+				selectedRanges.rbegin()->first >= count)
+			{
+				selectedRanges.erase(--selectedRanges.end());
+			}
+
+			if(!selectedRanges.empty() &&
+				selectedRanges.rbegin()->second > count)
+			{
+				selectedRanges.rbegin()->second = count;
+			}
+		}
+
+		if(!indexExists(firstSelIndex) || !indexExists(lastSelIndex))
+		{
+			firstSelIndex = -1;
+			lastSelIndex = -1;
+		}
+
+		setWidestItem();
+		itemsChanged();
+	}
+
+	bool ListBox::isIndexSelected( int index ) const
+	{
+		updateSelectionRanges();
+
+		//the last range that starts at or before index
+		std::map<int,int>::const_iterator it = selectedRanges.upper_bound(index);
+		if(it == selectedRanges.begin())
+		{
+			return false;
+		}
+		--it;
+
+		return index < it->second;
+	}
+
+	void ListBox::setIndexSelected( int index, bool selected )
+	{
+		setRangeSelected(index,index + 1,selected);
+	}
+
+	void ListBox::setRangeSelected( int startIndex, int endIndex, bool selected )
+	{
+		updateSelectionRanges();
+
+		if(startIndex < 0)
+		{
+			startIndex = 0;
+		}
+		if(endIndex > getLength())
+		{
+			endIndex = getLength();
+		}
+		if(startIndex >= endIndex)
+		{
 			return;
 		}
 
-		int cSz = 0;
-		int h = 0;
+		invalidate();
+		selectionFlagsStale = true;
+
+		//find the first range that overlaps or touches the new one
+		std::map<int,int>::iterator it = selectedRanges.upper_bound(startIndex);
+		if(it != selectedRanges.begin())
+		{
+			std::map<int,int>::iterator prev = it;
+			--prev;
+			if(prev->second >= startIndex)
+			{
+				it = prev;
+			}
+		}
 
+		//take out every range that overlaps or touches the new one
+		int low = startIndex;
+		int high = endIndex;
+		while(it != selectedRanges.end() && it->first <= endIndex)
+		{
+			if(it->first < low)
+			{
+				low = it->first;
+			}
+			if(it->second > high)
+			{
+				high = it->second;
+			}
+			selectedRanges.erase(it++);
+		}
+
+		if(selected)
+		{
+			selectedRanges[low] = high;
+		}
+		else
+		{
+			if(low < startIndex)
+			{
+				selectedRanges[low] = startIndex;
+			}
+			if(high > endIndex)
+			{
+				selectedRanges[endIndex] = high;
+			}
+		}
+	}
+
+	void ListBox::updateSelectionRanges() const
+	{
+		//with a model the ranges are the selection, the items are unused
+		if(!selectionDirty || model)
+		{
+			return;
+		}
+
+		//the items were reordered, rebuild the ranges from their flags
+		selectionDirty = false;
+		selectionFlagsStale = false;
+		selectedRanges.clear();
+
+		int start = -1;
+		int count = 0;
 		for(ListItem::const_iterator it = items.begin();
 			it != items.end(); ++it)
 		{
-			cSz = getFont()->getTextWidth(it->first.text);
-			if( cSz > h)
+			if(it->second && start == -1)
 			{
-				h = cSz;
+				start = count;
 			}
+			else if(!it->second && start != -1)
+			{
+				selectedRanges[start] = count;
+				start = -1;
+			}
+			count++;
 		}
-		widestItem = h;
 
+		if(start != -1)
+		{
+			selectedRanges[start] = count;
+		}
+	}
+
+	void ListBox::updateSelectionFlags() const
+	{
+		//the ranges are the selection, the flags are only written when
+		//the items are handed out
+		if(!selectionFlagsStale || selectionDirty || model)
+		{
+			return;
+		}
+
+		selectionFlagsStale = false;
+		for(ListItem::iterator it = items.begin(); it != items.end(); ++it)
+		{
+			it->second = false;
+		}
+
+		for(std::map<int,int>::const_iterator it = selectedRanges.begin();
+			it != selectedRanges.end(); ++it)
+		{
+			for(int i = it->first; i < it->second; ++i)
+			{
+				items[i].second = true;
+			}
+		}
+	}
+
+	void ListBox::shiftSelectionRanges( int index, int count )
+	{
+		updateSelectionRanges();
+
+		//the ranges that end before index do not move
+		std::map<int,int>::iterator it = selectedRanges.upper_bound(index);
+		if(it != selectedRanges.begin())
+		{
+			std::map<int,int>::iterator prev = it;
+			--prev;
+			if(prev->second >= index)
+			{
+				it = prev;
+			}
+		}
+
+		if(it == selectedRanges.end())
+		{
+			return;
+		}
+
+		std::vector<std::pair<int,int> > moved(it,selectedRanges.end());
+		selectedRanges.erase(it,selectedRanges.end());
+		selectionFlagsStale = true;
+
+		for(size_t i = 0; i < moved.size(); ++i)
+		{
+			int start = moved[i].first;
+			int end = moved[i].second;
+
+			if(count > 0)
+			{
+				//the inserted items are not selected, so they split a range
+				if(start < index && end > index)
+				{
+					selectedRanges[start] = index;
+					start = index;
+				}
+				if(end > index)
+				{
+					start += count;
+					end += count;
+				}
+			}
+			else
+			{
+				//the removed items are taken out of the range they were in
+				int removedEnd = index - count;
+				start = start <= index ? start :
+					(start >= removedEnd ? start + count : index);
+				end = end <= index ? end :
+					(end >= removedEnd ? end + count : index);
+			}
+
+			if(start >= end)
+			{
+				continue;
+			}
+
+			//ranges that touch after a removal become one
+			if(!selectedRanges.empty() && selectedRanges.rbegin()->second == start)
+			{
+				selectedRanges.rbegin()->second = end;
+			}
+			else
+			{
+				selectedRanges[start] = end;
+			}
+		}
+	}
+
+	std::vector<std::pair<int,int> > ListBox::getSelectedRanges() const
+	{
+		updateSelectionRanges();
+
+		return std::vector<std::pair<int,int> >(
+			selectedRanges.begin(),selectedRanges.end());
+	}
+
+	void ListBox::setRangeSelectionEvents( bool rangeEvents )
+	{
+		rangeSelectionEvents = rangeEvents;
+	}
+
+	bool ListBox::isRangeSelectionEvents() const
+	{
+		return rangeSelectionEvents;
+	}
+
+	void ListBox::dispatchSelectionRangeEvent( int startIndex, int endIndex, bool selected )
+	{
+		if(!isRangeSelectionEvents())
+		{
+			for(int i = startIndex; i < endIndex; ++i)
+			{
+				displatchSelectionEvent(i,selected);
+			}
+			return;
+		}
+
+		for(std::vector<SelectionListener*>::iterator it = selectionListeners.begin();
+			it != selectionListeners.end(); ++it)
+		{
+			(*it)->selectionRangeChanged(this,startIndex,endIndex,selected);
+		}
 	}
 
 	void ListBox::displatchSelectionEvent( int index, bool selected )
@@ -1390,7 +1801,7 @@ namespace agui {
 			for(std::vector<SelectionListener*>::iterator it = selectionListeners.begin();
 				it != selectionListeners.end(); ++it)
 			{
-				(*it)->selectionChanged(this,items[index].first.text,index,selected);
+				(*it)->selectionChanged(this,getItemAt(index),index,selected);
 			}
 		}
 		else if(index == -1)
@@ -1494,23 +1905,14 @@ namespace agui {
 	int ListBox::getBottomSelectedIndex() const
 	{
 
-		int count = getLength() - 1;
-		//finds the last selected index
-		if(!items.empty())
-		{
-			for(ListItem::const_reverse_iterator it = items.rbegin();
-				it != items.rend(); ++it)
-			{
-				if(it->second)
-				{
-					return count;
-				}
+		updateSelectionRanges();
 
-				count--;
-			}
+		if(selectedRanges.empty())
+		{
+			return -1;
 		}
 
-		return -1;
+		return selectedRanges.rbegin()->second - 1;
 	}
 
 	void ListBox::selectRange( int startIndex, int endIndex )
@@ -1531,9 +1933,16 @@ namespace agui {
 
 		clearSelectedIndexes();
 
+		if(isRangeSelectionEvents())
+		{
+			setRangeSelected(startIndex,endIndex + 1,true);
+			dispatchSelectionRangeEvent(startIndex,endIndex + 1,true);
+			return;
+		}
+
 		for (int i = startIndex; i <= endIndex; ++i)
 		{
-			items[i].second = true;
+			setIndexSelected(i,true);
 			displatchSelectionEvent(i,true);
 		}
 
@@ -1714,7 +2123,7 @@ namespace agui {
 		setSize(getWidth(),
 			getMargin(SIDE_TOP) +
 			getMargin(SIDE_BOTTOM) +
-			int(items.size()) * getItemHeight() +
+			getLength() * getItemHeight() +
 			hscroll
 			);
 	}
@@ -1747,6 +2156,14 @@ namespace agui {
 			throw agui::Exception("ListItem Not Found");
 		}
 
+		if(model)
+		{
+			modelItem.text = model->getItemText(index);
+			modelItem.color = model->getItemColor(index,getNewItemColor());
+			modelItem.tooltip = model->getItemToolTip(index);
+			return modelItem;
+		}
+
 		return items[index].first;
 	}
 
@@ -1757,6 +2174,11 @@ namespace agui {
 			throw agui::Exception("ListItem Not Found, ToolTip NOT set");
 		}
 
+		if(model)
+		{
+			return;
+		}
+
 		items[index].first.tooltip = text;
 	}
 
@@ -1767,13 +2189,24 @@ namespace agui {
 			throw agui::Exception("ListItem Not Found, Item Color NOT set");
 		}
 
+		if(model)
+		{
+			return;
+		}
+
 		items[index].first.color = color;
+		invalidate();
 	}
 
 	std::string ListBox::getToolTipText()
 	{
 		if(indexExists(getHoverIndex()))
 		{
+			if(model)
+			{
+				return model->getItemToolTip(getHoverIndex());
+			}
+
 			return items[getHoverIndex()].first.tooltip;
 		}
 
@@ -59,6 +59,7 @@ namespace agui {
 				setIconWidth(item->getIcon()->getWidth());
 			}
 		}
+		invalidate();
 	}
 
 	int PopUpMenu::getLength() const
@@ -95,6 +96,7 @@ namespace agui {
 	void PopUpMenu::setItemHeight( int height )
 	{
 		itemHeight = height;
+		invalidate();
 	}
 
 	int PopUpMenu::getItemHeight() const
@@ -110,6 +112,7 @@ namespace agui {
 	void PopUpMenu::setShowIcon( bool show )
 	{
 		showIcon = show;
+		invalidate();
 	}
 
 	bool PopUpMenu::isShowingIcon() const
@@ -129,6 +132,7 @@ namespace agui {
 	void PopUpMenu::setIconWidth( int width )
 	{
 		iconWidth = width;
+		invalidate();
 	}
 
 	int PopUpMenu::getIconWidth() const
@@ -143,6 +147,7 @@ namespace agui {
 			if(items[i] == item)
 			{
 				items.erase(items.begin() + i);
+				invalidate();
 				return;
 			}
 		}
@@ -151,6 +156,7 @@ namespace agui {
 	void PopUpMenu::setStartTextGap( int gap )
 	{
 		startTextGap = gap;
+		invalidate();
 	}	
 	
 	int PopUpMenu::getStartTextGap() const
@@ -160,6 +166,7 @@ namespace agui {
 	void PopUpMenu::setMiddleTextGap( int gap )
 	{
 		middleTextGap = gap;
+		invalidate();
 	}
 
 	int PopUpMenu::getMiddleTextGap() const
@@ -169,6 +176,7 @@ namespace agui {
 	void PopUpMenu::setEndTextGap( int gap )
 	{
 		endTextGap = gap;
+		invalidate();
 	}
 
 	int PopUpMenu::getEndTextGap() const
@@ -205,6 +213,7 @@ namespace agui {
 	void PopUpMenu::setSeparatorHeight( int height )
 	{
 		separatorHeight = height;
+		invalidate();
 	}
 
 	int PopUpMenu::getSeparatorHeight() const
@@ -286,6 +295,7 @@ namespace agui {
 	void PopUpMenu::clearItems()
 	{
 		items.clear();
+		invalidate();
 	}
 
 	void PopUpMenu::mouseLeave( MouseEvent &mouseEvent )
@@ -308,6 +318,7 @@ namespace agui {
 		if(index != getSelectedIndex())
 		{
 			selectedIndex = index;
+			invalidate();
 			selectedIndexChanged();
 		}
 		
@@ -395,6 +406,7 @@ namespace agui {
 		if(getGui())
 		{
 			getGui()->_widgetLocationChanged();
+			getGui()->updateWidgetUnderMouse();
 			Widget* wum = getGui()->getWidgetUnderMouse();
 
 			bool underPopUp = false;
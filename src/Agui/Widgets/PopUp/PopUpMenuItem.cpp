@@ -47,6 +47,10 @@ namespace agui {
 	void PopUpMenuItem::setItemType( MenuItemTypeEnum itemType )
 	{
 		this->itemType = itemType;
+		if(parentMenu)
+		{
+			parentMenu->invalidate();
+		}
 	}
 
 	PopUpMenuItem::MenuItemTypeEnum PopUpMenuItem::getItemType() const
@@ -102,11 +106,19 @@ namespace agui {
 	void PopUpMenuItem::setIcon( Image* image )
 	{
 		icon = image;
+		if(parentMenu)
+		{
+			parentMenu->invalidate();
+		}
 	}
 
 	void PopUpMenuItem::setShortcutText( const std::string& text )
 	{
 		shortcutText = text;
+		if(parentMenu)
+		{
+			parentMenu->invalidate();
+		}
 	}
 
 	const std::string& PopUpMenuItem::getShortcutText() const
@@ -117,6 +129,19 @@ namespace agui {
 	void PopUpMenuItem::setSubMenu( PopUpMenu* menu )
 	{
 		subMenu = menu;
+		if(parentMenu)
+		{
+			parentMenu->invalidate();
+		}
+	}
+
+	void PopUpMenuItem::setText( const std::string &text )
+	{
+		Widget::setText(text);
+		if(parentMenu)
+		{
+			parentMenu->invalidate();
+		}
 	}
 
 	PopUpMenu* PopUpMenuItem::getSubMenu() const
@@ -78,6 +78,7 @@ namespace agui {
 			size = 0;
 		}
 		radioButtonRadius = size;
+		invalidatePreferredSize();
 		positionRadioButton();
 		if(isAutosizing())
 		{
@@ -91,6 +92,10 @@ namespace agui {
 
 	void RadioButton::changeRadioButtonState( RadioButtonStateEnum state )
 	{
+		if(state != radioButtonState)
+		{
+			invalidate();
+		}
 		radioButtonState = state;
 
 		for(std::vector<RadioButtonListener*>::iterator it = 
@@ -158,6 +163,7 @@ namespace agui {
 			return;
 		}
 		checkedState = state;
+		invalidate();
 
 		for(std::vector<RadioButtonListener*>::iterator it = 
 			radioButtonListeners.begin();
@@ -219,6 +225,7 @@ namespace agui {
 	void RadioButton::setRadioButtonAlignment( AreaAlignmentEnum alignment )
 	{
 		radioButtonAlignment = alignment;
+		invalidatePreferredSize();
 		resizeCaption();
 		positionRadioButton();
 		if(isAutosizing())
@@ -282,6 +289,7 @@ namespace agui {
 			radioButtonPosition.getX() - getRadioButtonRadius(),
 			radioButtonPosition.getY() - getRadioButtonRadius()),
 			Dimension(getRadioButtonRadius() * 2, getRadioButtonRadius() * 2));
+		invalidate();
 	}
 
 
@@ -338,11 +346,19 @@ namespace agui {
 	void RadioButton::resizeToContents()
 	{
 		positionRadioButton();
+		_setSizeInternal(getPreferredSize());
+
+		if(getText().length() != 0)
+		{
+			resizeCaption();
+		}
+	}
 
+	Dimension RadioButton::computePreferredSize()
+	{
 		if(getText().length() == 0)
 		{
-			_setSizeInternal(Dimension(getRadioButtonRadius() * 2, getRadioButtonRadius() * 2));
-			return;
+			return Dimension(getRadioButtonRadius() * 2, getRadioButtonRadius() * 2);
 		}
 
 		int sizeX = getFont()->getTextWidth(getText());
@@ -370,16 +386,12 @@ namespace agui {
 			break;
 		}
 
-		_setSizeInternal(Dimension(sizeX + 
+		return Dimension(sizeX + 
 			getMargin(SIDE_LEFT) + 
 			getMargin(SIDE_RIGHT),
 			sizeY + 
 			getMargin(SIDE_TOP) +
-			getMargin(SIDE_BOTTOM))
-			);
-		resizeCaption();
-
-
+			getMargin(SIDE_BOTTOM));
 	}
 
 
@@ -618,6 +630,7 @@ namespace agui {
 	void RadioButton::setSidePadding(int padding) 
 	{
 		sidePadding = padding;
+		invalidatePreferredSize();
 
 		positionRadioButton();
 		if(isAutosizing())
@@ -49,6 +49,7 @@ namespace agui {
 		pChildVScroll = NULL;
 		pChildInset = NULL;
 		pChildContent = NULL;
+		updateDepth = 0;
 
 		if(contentContainer)
 		{
@@ -115,6 +116,12 @@ namespace agui {
 		setWheelScrollRate(2);
 		setHKeyScrollRate(6);
 		setVKeyScrollRate(6);
+
+		for(WidgetArray::iterator it = pChildContent->getChildBegin();
+			it != pChildContent->getChildEnd(); ++it)
+		{
+			childAdded(pChildContent,*it);
+		}
 	}
 
 	ScrollPane::~ScrollPane(void)
@@ -148,8 +155,11 @@ namespace agui {
 	void ScrollPane::add( Widget *widget )
 	{
 		pChildContent->add(widget);
-		pChildContent->setSize(Dimension(getContentWidth(),getContentHeight()));
-		updateScrollBars();
+		if(!isUpdating())
+		{
+			updateContentSize();
+			updateScrollBars();
+		}
 
 	}
 
@@ -162,8 +172,11 @@ namespace agui {
 			widget->removeWidgetListener(this);
 		}
 		pChildContent->remove(widget);
-		pChildContent->setSize(Dimension(getContentWidth(),getContentHeight()));
-		updateScrollBars();
+		if(!isUpdating())
+		{
+			updateContentSize();
+			updateScrollBars();
+		}
 	}
 
 	void ScrollPane::setHScrollPolicy( ScrollPolicy policy )
@@ -261,32 +274,71 @@ namespace agui {
 
 	int ScrollPane::getContentWidth() const
 	{
-		int w = 0;
-		for(WidgetArray::const_iterator it = pChildContent->getChildBegin();
-			it != pChildContent->getChildEnd(); ++it)
+		if(contentRights.empty() || *contentRights.rbegin() < 0)
 		{
-			if((*it)->getRelativeRectangle().getRight() > w)
-			{
-				w = (*it)->getRelativeRectangle().getRight();
-			}
+			return 0;
 		}
 
-		return w;
+		return *contentRights.rbegin();
 	}
 
 	int ScrollPane::getContentHeight() const
 	{
-		int h = 0;
-		for(WidgetArray::const_iterator it = pChildContent->getChildBegin();
-			it != pChildContent->getChildEnd(); ++it)
+		if(contentBottoms.empty() || *contentBottoms.rbegin() < 0)
 		{
-			if((*it)->getRelativeRectangle().getBottom() > h)
-			{
-				h = (*it)->getRelativeRectangle().getBottom();
-			}
+			return 0;
+		}
+
+		return *contentBottoms.rbegin();
+	}
+
+	void ScrollPane::addContentExtent( Widget* widget )
+	{
+		Rectangle rect = widget->getRelativeRectangle();
+		contentExtents[widget] = rect;
+		contentRights.insert(rect.getRight());
+		contentBottoms.insert(rect.getBottom());
+	}
+
+	void ScrollPane::removeContentExtent( Widget* widget )
+	{
+		std::map<Widget*,Rectangle>::iterator it = contentExtents.find(widget);
+		if(it == contentExtents.end())
+		{
+			return;
+		}
+
+		contentRights.erase(contentRights.find(it->second.getRight()));
+		contentBottoms.erase(contentBottoms.find(it->second.getBottom()));
+		contentExtents.erase(it);
+	}
+
+	void ScrollPane::updateContentExtent( Widget* widget )
+	{
+		if(contentExtents.find(widget) == contentExtents.end())
+		{
+			return;
+		}
+
+		removeContentExtent(widget);
+		addContentExtent(widget);
+		updateContentSize();
+	}
+
+	void ScrollPane::updateContentSize()
+	{
+		if(isUpdating())
+		{
+			return;
 		}
 
-		return h;
+		int w = getContentWidth();
+		int h = getContentHeight();
+
+		if(pChildContent->getWidth() != w || pChildContent->getHeight() != h)
+		{
+			pChildContent->setSize(Dimension(w,h));
+		}
 	}
 
 	bool ScrollPane::isHScrollNeeded() const
@@ -342,6 +394,12 @@ namespace agui {
 		(void)source; (void)text;
 	}
 
+	void ScrollPane::textEdited( Widget* source, int index,
+		int removedLength, int insertedLength )
+	{
+		(void)source; (void)index; (void)removedLength; (void)insertedLength;
+	}
+
 	void ScrollPane::valueChanged( HScrollBar* source, int val )
 	{
 		(void)source;
@@ -358,29 +416,35 @@ namespace agui {
 
 	void ScrollPane::sizeChanged( Widget* source, const Dimension &size )
 	{
-		(void)source; (void)size; 
-		updateScrollBars();
+		(void)size; 
 
-		if(source != pChildContent)
-		pChildContent->setSize(Dimension(getContentWidth(),getContentHeight()));
+		if(source == pChildContent)
+		{
+			updateScrollBars();
+			return;
+		}
+
+		//only a change of the content size moves the scroll bars
+		updateContentExtent(source);
 	}
 
 	void ScrollPane::locationChanged( Widget* source, const Point &location )
 	{
-		(void)source; (void)location;
+		(void)location;
 
-		if(source != pChildContent)
-		updateScrollBars();
+		if(source == pChildContent)
+		{
+			return;
+		}
 
-		if(source != pChildContent)
-		pChildContent->setSize(Dimension(getContentWidth(),getContentHeight()));
+		updateContentExtent(source);
 	}
 
 	void ScrollPane::setSize( const Dimension &size )
 	{
 		Widget::setSize(size);
 		updateScrollBars();
-		pChildContent->setSize(Dimension(getContentWidth(),getContentHeight()));
+		updateContentSize();
 
 	}
 
@@ -588,8 +652,12 @@ namespace agui {
 			widget->addWidgetListener(this);
 			widget->addMouseListener(this);
 			widget->addKeyboardListener(this);
+			addContentExtent(widget);
 
-			updateScrollBars();
+			if(!isUpdating())
+			{
+				updateScrollBars();
+			}
 		}
 	}
 
@@ -600,8 +668,7 @@ namespace agui {
 			widget->removeWidgetListener(this);
 			widget->removeMouseListener(this);
 			widget->removeKeyboardListener(this);
-
-
+			removeContentExtent(widget);
 		}
 	}
 
@@ -686,6 +753,31 @@ namespace agui {
 		resizeHeightToContents();
 	}
 
+	void ScrollPane::beginUpdate()
+	{
+		updateDepth++;
+	}
+
+	void ScrollPane::endUpdate()
+	{
+		if(updateDepth == 0)
+		{
+			return;
+		}
+
+		updateDepth--;
+		if(!isUpdating())
+		{
+			updateContentSize();
+			updateScrollBars();
+		}
+	}
+
+	bool ScrollPane::isUpdating() const
+	{
+		return updateDepth > 0;
+	}
+
 
 
 }
\ No newline at end of file
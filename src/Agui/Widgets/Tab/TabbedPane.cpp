@@ -222,6 +222,7 @@ namespace agui {
       if(selectedTab.first)
       {
         selectedTab.first->lostSelection();
+        selectedTab.first->invalidate();
         widgetContainer->remove(selectedTab.second);
       }
       
@@ -243,6 +244,7 @@ namespace agui {
       if(selectedTab.first)
       {
         selectedTab.first->lostSelection();
+        selectedTab.first->invalidate();
       }
       Widget* oldSecTab = NULL;
       if(selectedTab.second)
@@ -252,6 +254,7 @@ namespace agui {
 
         selectedTab = tabs[index];
         selectedTab.first->gainedSelection();
+        selectedTab.first->invalidate();
 
         widgetContainer->add(selectedTab.second);
         selectedTab.first->focus();
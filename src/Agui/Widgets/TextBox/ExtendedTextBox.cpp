@@ -113,14 +113,8 @@ namespace agui {
 		{
 			return;
 		}
-		textColors.clear();
-		int textLen = getTextLength();
-
-		for(size_t i = 0; i < textColors.size(); ++i)
-		{
-			textColors[i].first = getFontColor();
-		}
-
+		textStyles.clear();
+		invalidate();
 	}
 
 	const Point& ExtendedTextBox::getColorIndexStart() const
@@ -134,11 +128,7 @@ namespace agui {
 			int x;
 			size_t y;
 			x = indexFromColumnRow(0,getVisibleLineStart()) + 1;
-			y = 0;
-			for(int i = 0; i < x; ++i)
-			{
-				unicodeFunctions.bringToNextUnichar(y,getText());
-			}
+			y = getTextBuffer().getByteOffset(x);
 			colorIndexStart = Point(int(x), int(y));
 
 	}
@@ -147,14 +137,7 @@ namespace agui {
 	{
 		//maintain
 
-		if((int)unicodeFunctions.length(text) > getMaxLength())
-		{
-			Widget::setText(unicodeFunctions.subStr(text,0,getMaxLength()));
-		}
-		else
-		{
-			Widget::setText(text);
-		}
+		setBufferText(text);
 
 		clearColors();
 		updateText();
@@ -165,7 +148,7 @@ namespace agui {
 			mousePositionCaret(columnRowFromIndex(getTextLength()));
 		}
 
-		if(!isEditingText && textColors.size() == 0)
+		if(!isEditingText && textStyles.getLength() == 0)
 		{
 			size_t uniPos = 0;
 			int bytesSkipped = 0;
@@ -192,7 +175,7 @@ namespace agui {
 					newStr += curStr;
 				}
 
-				textColors.insert(textColors.begin() + (i),std::make_pair(currentColor,emoticon));
+				textStyles.insert((int)i,1,currentColor,emoticon);
 			}
 
 		}
@@ -207,7 +190,7 @@ namespace agui {
 
 		if(index != -1)
 		{
-			textColors.erase(textColors.begin() + index);
+			textStyles.erase(index,1);
 		}
 		return index;
 	}
@@ -220,7 +203,7 @@ namespace agui {
 
 		if(index != -1)
 		{
-			textColors.erase(textColors.begin() + index);
+			textStyles.erase(index,1);
 		}
 		return index;
 	}
@@ -229,8 +212,7 @@ namespace agui {
 	{
 		if(!isSelectionEmpty())
 		{
-			textColors.erase(textColors.begin() + (getSelectionStart()),
-				textColors.begin() +( getSelectionStart())  + (getSelectionEnd() - getSelectionStart()));
+			textStyles.erase(getSelectionStart(),getSelectionEnd() - getSelectionStart());
 		}
 		
 
@@ -258,24 +240,30 @@ namespace agui {
 		}
 		else
 		{
-			if(index - 1 >= 0 && index - 1 < (int)textColors.size())
+			if(index - 1 >= 0 && index - 1 < textStyles.getLength())
 			{
-				currentColor = textColors[index - 1].first;
+				currentColor = textStyles.getColorAt(index - 1);
 			}
-			else if(index + 1 >= 0 && index + 1 < (int)textColors.size())
+			else if(index + 1 >= 0 && index + 1 < textStyles.getLength())
 			{
-				currentColor = textColors[index + 1].first;
+				currentColor = textStyles.getColorAt(index + 1);
 			}
 		}
 		
 
-		Image* img = NULL;
-		textColors.insert(textColors.begin() + index,std::make_pair(currentColor,img));
+		textStyles.insert(index,1,currentColor,NULL);
 
 
 		return index;
 	}
 
+	int ExtendedTextBox::trimLines()
+	{
+		int length = TextBox::trimLines();
+		textStyles.erase(0,length);
+		return length;
+	}
+
 	void ExtendedTextBox::setCurrentColor( const Color &color )
 	{
 		currentColor = color;
@@ -289,10 +277,8 @@ namespace agui {
 			return;
 		}
 
-		for(int i = getSelectionStart() ; i < getSelectionEnd(); ++i)
-		{
-			textColors[i].first = color;
-		}
+		textStyles.setColor(getSelectionStart(),getSelectionEnd() - getSelectionStart(),color);
+		invalidate();
 	}
 
 	void ExtendedTextBox::setFont( const Font *font )
@@ -321,7 +307,10 @@ namespace agui {
 		std::string newStr;
 		std::string curChar;
 		size_t textLen = unicodeFunctions.length(text);
-		
+
+		//characters without an emoticon are colored as one run
+		int runStart = index;
+		int runLength = 0;
 
 		for(size_t i = 0; i < textLen && (getTextLength() + i) < (size_t)getMaxLength(); ++i)
 		{
@@ -335,18 +324,22 @@ namespace agui {
 			if(emoticon)
 			{
 				newStr += emoticonChar;
+				textStyles.insert(runStart,runLength,currentColor,NULL);
+				textStyles.insert(runStart + runLength,1,currentColor,emoticon);
+				runStart += runLength + 1;
+				runLength = 0;
 			}
 			else
 			{
 				newStr += curStr;
+				runLength++;
 			}
-
-			textColors.insert(textColors.begin() + (i + index),std::make_pair(currentColor,emoticon));
 		}
-		
+
+		textStyles.insert(runStart,runLength,currentColor,NULL);
 
 		isEditingText = true;
-		TextBox::appendText(newStr,atCurrentPosition);
+		TextBox::appendText(newStr,atCurrentPosition,repositionCaret);
 		isEditingText = false;
 
 		if(textLen > 0)
@@ -361,214 +354,129 @@ namespace agui {
 
 	void ExtendedTextBox::drawText( const PaintEvent &paintEvent )
 	{
-		/* start of crazy render procedure */
-
 		//note: this won't work with Kerning so keep it off!
 
 		int textX = getHorizontalOffset();
 		int textY = getVerticalOffset();
 
-		size_t curLen = 0;
-		int curWidth = 0;
-		int totalWidth = 0;
-		size_t uniPos = 0;
-		size_t colorUniPos = 0;
-		size_t bytesSkipped = 0;
-
-
 		int colorIndex = getColorIndexStart().getX();
-		colorUniPos = getColorIndexStart().getY();
-		int stopPos = 0;
-		size_t stopUnichar;
-		const Color *color;
-		int selStart = 0; 
-		int selEnd = 0; 
-
-		if(!isHidingSelection() || (isHidingSelection() && isFocused()))
+		int selStart = 0;
+		int selEnd = 0;
+
+		if(isSelectionFontColorInUse() && !isSelectionEmpty() &&
+			(!isHidingSelection() || isFocused()))
 		{
-			selStart = getSelectionStart() - 1;
-			selEnd = getSelectionEnd() - 1;
+			selStart = getSelectionStart();
+			selEnd = getSelectionEnd();
 		}
 
+		std::string line;
+		std::string chunk;
+		Color runColor;
+		Image* img = NULL;
+
 		int linesSkipped = getVisibleLineStart();
 		int maxitems = getVisibleLineCount();
 		for(int i = linesSkipped; i <= maxitems + linesSkipped; ++i)
 		{
-			int curColIndex = colorIndex;
 			if(i >= getTextLineCount())
 			{
 				break;
 			}
-			uniPos = 0;
-			bytesSkipped = 0;
-			totalWidth = 0;
-
+			line = getTextLineAt(i);
+			size_t uniPos = 0;
+			int totalWidth = 0;
 			int len = getRowLength(i);
+			int lineX = textX + getLineOffset(i);
+			int lineY = textY + (i * getLineHeight());
 
 			//increase color index if at newline
-			if(getText()[colorUniPos] == '\n')
+			if(getTextBuffer().isNewline(colorIndex))
 			{
 				colorIndex++;
-
 			}
-			bool isSame = true;
 
-			//check if line is same color
-			//store result for later use and store stop position
-			if(len == 1)
+			//draw each run of same styled characters in one go
+			int drawn = 0;
+			while(drawn < len)
 			{
-				isSame = false;
-				stopPos = len;
-			}
-			for(int x = len - 1; x > 0; --x)
-			{
-				//not null if emoticon is present
-				if(textColors[colorIndex + x].first != textColors[colorIndex + x - 1].first ||
-					textColors[colorIndex + x].second != NULL || textColors[colorIndex + x - 1].second != NULL)
+				int count = textStyles.getRun(colorIndex,runColor,img);
+				if(count == 0)
 				{
-					isSame = false;
-					stopPos = x;
-
-					if(textColors[colorIndex + x].second != NULL || textColors[colorIndex + x - 1].second != NULL)
-					{
-						stopPos = len;
-					}
-					break;
+					runColor = getFontColor();
+					img = NULL;
+					count = len - drawn;
 				}
-			}
 
-			if(len == 0)
-			{
-				stopPos = 0;
-			}
+				if(count > len - drawn)
+				{
+					count = len - drawn;
+				}
 
-			//only use this method if the whole line is selected
-			if(!isSelectionEmpty() && colorIndex + len >= selStart &&
-				colorIndex <= selEnd &&
-				!(colorIndex > selStart &&
-				colorIndex + len < selEnd))
-			{
-				isSame = false;
-				stopPos = len;
-			}
-			//if the whole line is the same color render it in one go
-			if(isSame && len > 0 )
-			{
-				//white for selection
-				if(colorIndex > selStart && colorIndex <= selEnd && isSelectionFontColorInUse())
+				//the selection bounds also end a run
+				bool selected = colorIndex >= selStart && colorIndex < selEnd;
+				if(selected && colorIndex + count > selEnd)
 				{
-					color = &selectionFontColor;
+					count = selEnd - colorIndex;
 				}
-				else
+				else if(!selected && colorIndex < selStart && colorIndex + count > selStart)
 				{
-					color = &textColors[colorIndex].first;
+					count = selStart - colorIndex;
 				}
 
-				paintEvent.graphics()->drawText(Point(textX + getLineOffset(i),
-					textY + (i * getLineHeight())),
-					getTextLineAt(i).c_str(),*color,getFont());
-
-				//increase color index by how many unichars we drew
-				colorIndex += len;
-
-			}
-			else //render char by char until last chunk
-			{
+				const Color &color = selected ? selectionFontColor : runColor;
 
-				for(int j = 0; j < stopPos; ++j)
+				if(img)
 				{
-					//get length of unichar
-					curLen = unicodeFunctions.bringToNextUnichar(uniPos,getTextLineAt(i));
-
-					//white for selection
-					if(colorIndex > selStart && colorIndex <= selEnd && isSelectionFontColorInUse())
-					{
-						color = &selectionFontColor;
-					}
-					else
+					for(int j = 0; j < count; ++j)
 					{
-						color = &textColors[colorIndex].first;
-					}
-
-					//extract current character
-					curStr = getTextLineAt(i).substr(bytesSkipped,curLen);
-					curWidth = getTextWidth(curStr);
-
-					//increase byte count to keep track of where we are
-					bytesSkipped += curLen;
+						size_t start = uniPos;
+						int curLen = unicodeFunctions.bringToNextUnichar(uniPos,line);
+						int curWidth = getTextWidth(line.substr(start,curLen));
 
-					Image* img = textColors[colorIndex].second;
-					if (img)
-					{
 						paintEvent.graphics()->drawScaledImage(
 							img,
-							Point(textX + totalWidth  + getLineOffset(i),
-							textY + (i * getLineHeight())),
+							Point(lineX + totalWidth,lineY),
 							Point(),Dimension(img->getWidth(),img->getHeight()),
 							Dimension(curWidth,curWidth)
 							);
-					}
-					else
-					{
-						//draw the char
-						paintEvent.graphics()->drawText(Point(textX + totalWidth  + getLineOffset(i),
-							textY + (i * getLineHeight())),
-							curStr.c_str(),*color,getFont());
-					}
-			
-
-					//increase the total width
-					totalWidth += curWidth;
-
-					colorIndex++;
-
 
+						totalWidth += curWidth;
+					}
 				}
-				//if we have 1 last chunk to draw, draw it
-				if(stopPos < len && stopPos >= 0)
+				else
 				{
-					stopUnichar = 0;
-					for(int x = 0; x < stopPos; ++x)
+					size_t start = uniPos;
+					for(int j = 0; j < count; ++j)
 					{
-						unicodeFunctions.bringToNextUnichar(stopUnichar,getTextLineAt(i));
+						unicodeFunctions.bringToNextUnichar(uniPos,line);
 					}
-					//white for selection
-					if(colorIndex > selStart && colorIndex <= selEnd && isSelectionFontColorInUse())
+
+					if(drawn + count == len)
 					{
-						color = &selectionFontColor;
+						//the last run takes the rest of the line
+						paintEvent.graphics()->drawText(Point(lineX + totalWidth,lineY),
+							&line[start],color,getFont());
 					}
 					else
 					{
-						color = &textColors[colorIndex].first;
+						chunk = line.substr(start,uniPos - start);
+						paintEvent.graphics()->drawText(Point(lineX + totalWidth,lineY),
+							chunk.c_str(),color,getFont());
+						totalWidth += getTextWidth(chunk);
 					}
-
-					//draw the chunk
-					paintEvent.graphics()->drawText(Point(textX + totalWidth  + getLineOffset(i),
-						textY + (i * getLineHeight())),
-						&getTextLineAt(i)[stopUnichar],*color,getFont());
 				}
-				//increase the color index by the number of unichars drawn
-				colorIndex += len - stopPos;
-
-
 
-			}
-
-			int colorIndexChange = colorIndex - curColIndex;
-			for(int i = 0; i < colorIndexChange; ++i)
-			{
-				unicodeFunctions.bringToNextUnichar(colorUniPos,getText());
+				drawn += count;
+				colorIndex += count;
 			}
 		}
-
-		/* end of crazy render procedure */
-
-
 	}
 
 	void ExtendedTextBox::setSelectionFontColor( const Color &color )
 	{
 		selectionFontColor = color;
+		invalidate();
 	}
 
 	const Color& ExtendedTextBox::getSelectionFontColor() const
@@ -584,6 +492,7 @@ namespace agui {
 	void ExtendedTextBox::setIsSelectionFontColorInUse( bool wantSelectionColor )
 	{
 		selFontColor = wantSelectionColor;
+		invalidate();
 	}
 
 	void ExtendedTextBox::registerEmoticon( const std::string& triggerChar, Image* image, const std::string& clipboardText )
@@ -638,7 +547,7 @@ namespace agui {
 				curStr = text.substr(bytesSkipped,curLen);
 				bytesSkipped += curLen;
 
-				Image* emoticon = textColors[start + i].second;
+				Image* emoticon = textStyles.getImageAt(start + (int)i);
 
 				if(emoticon)
 				{
@@ -42,18 +42,44 @@
 #include "Agui/EmptyWidget.hpp"
 
 namespace agui {
+	//replaces values [first, last) and only moves the rest if the count changed
+	template <class T>
+	static void replaceValues(std::deque<int> &values, int first, int last,
+		const T &replacement)
+	{
+		int count = int(replacement.size());
+		int common = count < last - first ? count : last - first;
+		std::copy(replacement.begin(),replacement.begin() + common,
+			values.begin() + first);
+
+		if(count > common)
+		{
+			values.insert(values.begin() + first + common,
+				replacement.begin() + common,replacement.end());
+		}
+		else if(last - first > common)
+		{
+			values.erase(values.begin() + first + common,values.begin() + last);
+		}
+	}
+
 	TextBox::TextBox( HScrollBar *hScroll /*= NULL*/,
 							 VScrollBar *vScroll /*= NULL*/,
 							 Widget *scrollInset /*= NULL*/)
-	: topPadding(2), leftPadding(5), bottomPadding(0), rightPadding(5),
-	  hScrollPolicy(SHOW_AUTO), vScrollPolicy(SHOW_AUTO),
-	  horizontalOffset(0),verticalOffset(0), caretRow(0),caretColumn(0),
-	  caretRowLocation(0), caretColumnLocation(0),widestLine(0),
-	  wordWrap(false),readOnly(false),drawBorder(true),maxSkip(10),numSelLines(0), mouseDownIndex(0),
-	  dragged(false),splittingWords(true),standardArrowKeyRules(true),
-	  textAlignment(ALIGN_LEFT),selectionBackColor(Color(169,193,214)),
-	  hideSelection(true),selfSetText(false),maxLength(100000),selectable(true),
-	  hotkeys(true)
+	: selfSetText(false),hideSelection(true),standardArrowKeyRules(true),
+	  splittingWords(true),dragged(false),textAlignment(ALIGN_LEFT),
+	  mouseDownIndex(0),widestLine(0),numSelLines(0),
+	  paragraphRowBase(0),paragraphIndexBase(0),paragraphShiftStart(0),
+	  paragraphRowShift(0),paragraphIndexShift(0),
+	  layoutWidth(-1),layoutLength(0),
+	  hasPendingEdit(false),pendingEditIndex(0),pendingEditRemoved(0),
+	  pendingEditInserted(0),selectionBackColor(Color(169,193,214)),
+	  topPadding(2), leftPadding(5), bottomPadding(0), rightPadding(5),
+	  verticalOffset(0),horizontalOffset(0), caretRow(0),caretColumn(0),
+	  caretRowLocation(0), caretColumnLocation(0),maxSkip(10),
+	  selectable(true),wordWrap(false),readOnly(false),drawBorder(true),
+	  maxLength(100000),maxLineCount(0),autoScrolling(false),hotkeys(true),
+	  hScrollPolicy(SHOW_AUTO), vScrollPolicy(SHOW_AUTO)
 	{
 		if(hScroll)
 		{
@@ -297,7 +323,7 @@ namespace agui {
 
 	int TextBox::getContentHeight() const
 	{
-		return int(textRows.size() * getLineHeight());
+		return int(rowLengths.size() * getLineHeight());
 	}
 
 	int TextBox::getContentWidth() const
@@ -382,11 +408,13 @@ namespace agui {
 	void TextBox::setBottomPadding( int padding )
 	{
 		bottomPadding = padding;
+		invalidate();
 	}
 
 	void TextBox::setRightPadding( int padding )
 	{
 		rightPadding = padding;
+		invalidate();
 	}
 
 	void TextBox::valueChanged( HScrollBar* source, int val )
@@ -442,14 +470,14 @@ namespace agui {
 
 		for(int i = linesSkipped; i <= maxitems + linesSkipped; ++i)
 		{
-			if(i >= (int)textRows.size())
+			if(i >= (int)rowLengths.size())
 			{
 				break;
 			}
 
 			paintEvent.graphics()->drawText(Point(textX + getLineOffset(i),
 				textY + (i * getLineHeight())),
-				textRows[i].c_str(),getFontColor(),getFont());
+				getTextLineAt(i).c_str(),getFontColor(),getFont());
 
 		}
 		
@@ -495,80 +523,75 @@ namespace agui {
 
 	void TextBox::updateText()
 	{
+		invalidate();
+
+		if(hasPendingEdit)
+		{
+			hasPendingEdit = false;
+			if(layoutEditedParagraphs())
+			{
+				return;
+			}
+		}
+
 		if(isWordWrap())
 		makeLinesFromWordWrap();
 		else
 		makeLinesFromNewline();
-
-		rowLengths.clear();
-		for(size_t i = 0; i < textRows.size(); ++i)
-		{
-			rowLengths.push_back(int(unicodeFunctions.length(textRows[i])));
-		}
 	}
 
 	void TextBox::makeLinesFromNewline()
 	{
-		textRows.clear();
-		textRows.push_back("");
-
-		int bytesSkipped = 0;
-		int curCharLen = 0;
-		std::string curChar;
-
-		size_t ind = 0;
+		layoutAllParagraphs(getWrapWidth());
+		updateWidestLine();
+	}
 
-		int len = getTextLength();
-		for(int i = 0; i < len; ++i)
+	void TextBox::setText( const std::string &text )
+	{
+		setBufferText(text);
+		updateText();
+		updateScrollBars();
+		setSelection(0,0);
+		if(!isSelfSettingText())
 		{
-			curCharLen = int(unicodeFunctions.bringToNextUnichar(ind,getText()));
-			curChar = getText().substr(bytesSkipped,curCharLen);
-			bytesSkipped += curCharLen;
-		
+			mousePositionCaret(columnRowFromIndex(getTextLength()));
+		}
+	}
 
-			if(curChar[0] == '\n')
-			{
-				textRows.push_back("");
-				continue;
-			}
+	void TextBox::makeLinesFromWordWrap()
+	{
+		bool isVscroll = pChildVScroll->isVisible();
+		layoutAllParagraphs(getWrapWidth());
 
-			if(curChar[0] != '\n')
-				textRows.back() += curChar;
+		//if we need a Vscroll bar start over
+		if(!isVscroll && isVScrollNeeded())
+		{
+			layoutAllParagraphs(getAdjustedWidth() - pChildVScroll->getWidth());
 		}
 
-		
-			updateWidestLine();
-			lineOffset.clear();
-			for(size_t i = 0; i < textRows.size(); ++i)
-			{
-				lineOffset.push_back(0);
-			}
+		updateWidestLine();
 	}
 
-	void TextBox::setText( const std::string &text )
+	int TextBox::getWrapWidth() const
 	{
-		if((int)unicodeFunctions.length(text) > getMaxLength())
+		if(!isWordWrap())
 		{
-			Widget::setText(unicodeFunctions.subStr(text,0,getMaxLength()));
-		}
-		else
-		{
-			Widget::setText(text);
+			return 0;
 		}
-		
-		updateText();
-		updateScrollBars();
-		setSelection(0,0);
-		if(!isSelfSettingText())
+
+		int voffset = 0;
+		if(pChildVScroll->isVisible())
 		{
-			mousePositionCaret(columnRowFromIndex(getTextLength()));
+			voffset = pChildVScroll->getWidth();
 		}
+
+		return getAdjustedWidth() - voffset;
 	}
 
-	void TextBox::makeLinesFromWordWrap()
+	void TextBox::wrapParagraph( const std::string &paragraph, int width,
+		std::vector<std::string> &rows ) const
 	{
-		textRows.clear();
-		textRows.push_back("");
+		rows.push_back("");
 		std::string curStr;
 		std::string curWord;
 
@@ -576,126 +599,406 @@ namespace agui {
 		int curLetterWidth = 0;
 		int curLineWidth = 0;
 
-		bool isVscroll = pChildVScroll->isVisible();
-		int voffset = 0;
-		if(isVscroll)
-		{
-			voffset = pChildVScroll->getWidth();
-		}
-		int AdjWidthMinusVoffset = getAdjustedWidth() - voffset;
-		size_t len = getTextLength();
 		size_t bytesSkipped = 0;
 		size_t letterLength = 0;
 		size_t ind = 0;
 
-		for(size_t i = 0; i < len; ++i)
+		while(bytesSkipped < paragraph.length())
 		{
-			
 			//get the unicode character
-			letterLength = unicodeFunctions.bringToNextUnichar(ind,getText());
-			curStr = getText().substr(bytesSkipped,letterLength);
-			
-			
+			letterLength = unicodeFunctions.bringToNextUnichar(ind,paragraph);
+			curStr = paragraph.substr(bytesSkipped,letterLength);
 			bytesSkipped += letterLength;
 
 			curLetterWidth = getTextWidth(curStr);
 
-			//push a new line
-			if(curStr[0] == '\n')
+			//ensure word is not longer than the width
+			if(curWordWidth + curLetterWidth >= width)
 			{
-				textRows.back() += curWord;
+				rows.back() += curWord;
+
+				rows.push_back("");
 				curWord = "";
-				curLetterWidth = 0;
 				curWordWidth = 0;
 				curLineWidth = 0;
-				textRows.push_back("");
-				continue;
 			}
 
+			//add letter to word
+			curWord += curStr;
+			curWordWidth += curLetterWidth;
 
-		
-				//ensure word is not longer than the width
-				if(curWordWidth + curLetterWidth >= AdjWidthMinusVoffset)
+			if(curLineWidth + curWordWidth >= 
+				width && rows.back().length() >= 1)
+			{
+				rows.push_back("");
+				curLineWidth = 0;
+			}
+
+			if(isSplittingWords())
+			{
+				if(curStr[0] == ' ' || curStr[0] == '-')
 				{
-					textRows.back() += curWord;
-					
-					textRows.push_back("");
+					rows.back() += curWord;
+					curLineWidth += curWordWidth;
 					curWord = "";
 					curWordWidth = 0;
-					curLineWidth = 0;
 				}
+			}
+		}
 
-				//add letter to word
-				curWord += curStr;
-				curWordWidth += curLetterWidth;
-			
+		if(curWord != "")
+		{
+			rows.back() += curWord;
+		}
+	}
+
+	void TextBox::relayoutParagraphs( int firstParagraph, int lastParagraph,
+		int indexBegin, int indexEnd, int width )
+	{
+		std::deque<int> lengths;
+		std::deque<int> starts;
+		std::deque<int> offsets;
+		std::deque<int> widths;
+		std::vector<int> paraRows;
+		std::vector<int> paraIndexes;
+		std::vector<std::string> rows;
+
+		int numParagraphs = int(paragraphRows.size());
+
+		//the paragraphs that are replaced must not carry the pending shift
+		moveParagraphShift(lastParagraph + 1 < numParagraphs ?
+			lastParagraph + 1 : numParagraphs);
+
+		int firstRow = firstParagraph < numParagraphs ?
+			getParagraphRow(firstParagraph) : int(rowLengths.size());
+		int lastRow = lastParagraph + 1 < numParagraphs ?
+			getParagraphRow(lastParagraph + 1) : int(rowLengths.size());
 
-			//if we need a Vscroll bar start over
-			if(!isVscroll && isVScrollNeeded())
+		//only the text of the range is copied out of the buffer
+		std::string rangeText;
+		const std::string *text = &rangeText;
+		if(indexBegin == 0 && indexEnd == textBuffer.getLength())
+		{
+			text = &textBuffer.getString();
+		}
+		else
+		{
+			rangeText = textBuffer.getSubString(indexBegin,indexEnd - indexBegin);
+		}
+
+		int index = indexBegin;
+		size_t begin = 0;
+		size_t end = 0;
+		std::string paragraph;
+
+		//lay out each paragraph in the range on its own
+		for(;;)
+		{
+			end = text->find('\n',begin);
+			if(end == std::string::npos)
 			{
-				isVscroll = true;
-				voffset = pChildVScroll->getWidth();
-				AdjWidthMinusVoffset = getAdjustedWidth() - voffset;
-				i = -1;
-				curWord = "";
-				curStr = "";
-				textRows.clear();
-				textRows.push_back("");
-				ind = 0;
+				end = text->length();
+			}
 
-				curWordWidth = 0;
-				curLetterWidth = 0;
-				curLineWidth = 0;
+			paraRows.push_back(firstRow + int(lengths.size()) + paragraphRowBase);
+			paraIndexes.push_back(index + paragraphIndexBase);
 
-				bytesSkipped = 0;
-				continue;
+			rows.clear();
+			paragraph = text->substr(begin,end - begin);
+			if(isWordWrap())
+			{
+				wrapParagraph(paragraph,width,rows);
+			}
+			else
+			{
+				rows.push_back(paragraph);
 			}
 
-			if(curLineWidth + curWordWidth >= 
-				AdjWidthMinusVoffset && textRows.back().length() >= 1)
+			int rowStart = 0;
+			for(size_t i = 0; i < rows.size(); ++i)
 			{
-				textRows.push_back("");
-				curLineWidth = 0;
+				int len = int(unicodeFunctions.length(rows[i]));
+				lengths.push_back(len);
+				starts.push_back(rowStart);
+				rowStart += len;
+
+				if(!isWordWrap())
+				{
+					widths.push_back(getTextWidth(rows[i]));
+					offsets.push_back(0);
+					continue;
+				}
+
+				switch(getTextAlignment())
+				{
+				case ALIGN_LEFT:
+					offsets.push_back(0);
+					break;
+				case ALIGN_CENTER:
+					offsets.push_back((width - getTextWidth(rows[i])) / 2);
+					break;
+				case ALIGN_RIGHT:
+					offsets.push_back(width - getTextWidth(rows[i]));
+					break;
+				default:
+					offsets.push_back(0);
+					break;
+				}
 			}
+			index += rowStart;
 
-			if(isSplittingWords())
+			if(end >= text->length())
 			{
-				if(curStr[0] == ' ' || curStr[0] == '-')
+				break;
+			}
+
+			//skip the newline
+			index++;
+			begin = end + 1;
+		}
+
+		//the paragraphs that follow are shifted when they are reached
+		if(lastParagraph + 1 < numParagraphs)
+		{
+			paragraphIndexShift += index + 1 - getParagraphIndex(lastParagraph + 1);
+			paragraphRowShift += int(lengths.size()) - (lastRow - firstRow);
+		}
+
+		//the widest line only needs a full scan if it was removed
+		bool rescanWidest = false;
+		if(!isWordWrap())
+		{
+			for(int i = firstRow; i < lastRow && i < (int)rowWidths.size(); ++i)
+			{
+				if(rowWidths[i] >= widestLine)
 				{
-					textRows.back() += curWord;
-					curLineWidth += curWordWidth;
-					curWord = "";
-					curWordWidth = 0;
+					rescanWidest = true;
+					break;
 				}
 			}
-		
 		}
 
-		if(curWord != "")
+		if(firstRow == 0 && lastRow == (int)rowLengths.size())
 		{
-			textRows.back() += curWord;
+			rowLengths.swap(lengths);
+			rowOffsets.swap(starts);
+			lineOffset.swap(offsets);
+			rowWidths.swap(widths);
+		}
+		else
+		{
+			replaceValues(rowLengths,firstRow,lastRow,lengths);
+			replaceValues(rowOffsets,firstRow,lastRow,starts);
+			replaceValues(lineOffset,firstRow,lastRow,offsets);
+			if(!isWordWrap())
+			{
+				replaceValues(rowWidths,firstRow,lastRow,widths);
+			}
+		}
+
+		int removeEnd = paragraphShiftStart;
+		if(firstParagraph > removeEnd)
+		{
+			removeEnd = firstParagraph;
+		}
+		replaceValues(paragraphRows,firstParagraph,removeEnd,paraRows);
+		replaceValues(paragraphIndexes,firstParagraph,removeEnd,paraIndexes);
+		paragraphShiftStart = firstParagraph + int(paraRows.size());
+
+		if(isWordWrap())
+		{
+			widestLine = 0;
+		}
+		else if(rescanWidest)
+		{
+			widestLine = 0;
+			for(size_t i = 0; i < rowWidths.size(); ++i)
+			{
+				if(rowWidths[i] > widestLine)
+				{
+					widestLine = rowWidths[i];
+				}
+			}
+		}
+		else
+		{
+			for(size_t i = 0; i < widths.size(); ++i)
+			{
+				if(widths[i] > widestLine)
+				{
+					widestLine = widths[i];
+				}
+			}
 		}
-		updateWidestLine();
 
+		layoutLength = getTextLength();
+	}
+
+	void TextBox::layoutAllParagraphs( int width )
+	{
+		rowLengths.clear();
+		rowOffsets.clear();
 		lineOffset.clear();
-		for(size_t i = 0; i < textRows.size(); ++i)
+		rowWidths.clear();
+		paragraphRows.clear();
+		paragraphIndexes.clear();
+		paragraphRowBase = 0;
+		paragraphIndexBase = 0;
+		paragraphShiftStart = 0;
+		paragraphRowShift = 0;
+		paragraphIndexShift = 0;
+		widestLine = 0;
+
+		relayoutParagraphs(0,-1,0,textBuffer.getLength(),width);
+		layoutWidth = width;
+	}
+
+	bool TextBox::layoutEditedParagraphs()
+	{
+		if(paragraphRows.empty() || layoutWidth != getWrapWidth())
 		{
-			switch(getTextAlignment())
+			return false;
+		}
+
+		int start = pendingEditIndex;
+		int end = pendingEditIndex + pendingEditRemoved;
+
+		if(start < 0 || end > layoutLength || getTextLength() !=
+			layoutLength - pendingEditRemoved + pendingEditInserted)
+		{
+			return false;
+		}
+
+		//find the paragraphs that contain the start and end of the edit
+		int firstParagraph = getParagraphAtIndex(start);
+		int lastParagraph = getParagraphAtIndex(end);
+
+		//the newline ending the last paragraph is untouched by the edit
+		int indexEnd = getTextLength();
+		if(lastParagraph + 1 < (int)paragraphIndexes.size())
+		{
+			indexEnd = getParagraphIndex(lastParagraph + 1) - 1 +
+				getTextLength() - layoutLength;
+		}
+
+		relayoutParagraphs(firstParagraph,lastParagraph,
+			getParagraphIndex(firstParagraph),indexEnd,layoutWidth);
+
+		//the new rows may need a Vscroll bar, which changes the width
+		if(isWordWrap() && !pChildVScroll->isVisible() && isVScrollNeeded())
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	void TextBox::moveParagraphShift( int paragraph )
+	{
+		if(paragraphRowShift != 0 || paragraphIndexShift != 0)
+		{
+			//the paragraphs passed over take the shift now
+			for(int i = paragraphShiftStart; i < paragraph; ++i)
 			{
-			case ALIGN_LEFT:
-				lineOffset.push_back(0);
-				break;
-			case ALIGN_CENTER:
-				lineOffset.push_back((AdjWidthMinusVoffset - 
-					getTextWidth(textRows[i])) / 2);
-				break;
-			case ALIGN_RIGHT:
-				lineOffset.push_back(AdjWidthMinusVoffset - 
-					getTextWidth(textRows[i]));
-				break;
+				paragraphRows[i] += paragraphRowShift;
+				paragraphIndexes[i] += paragraphIndexShift;
 			}
-			
+
+			//the paragraphs that get the shift later must not count it twice
+			for(int i = paragraph; i < paragraphShiftStart; ++i)
+			{
+				paragraphRows[i] -= paragraphRowShift;
+				paragraphIndexes[i] -= paragraphIndexShift;
+			}
+		}
+
+		paragraphShiftStart = paragraph;
+	}
+
+	int TextBox::getParagraphRow( int paragraph ) const
+	{
+		int row = paragraphRows[paragraph] - paragraphRowBase;
+		if(paragraph >= paragraphShiftStart)
+		{
+			row += paragraphRowShift;
+		}
+
+		return row;
+	}
+
+	int TextBox::getParagraphIndex( int paragraph ) const
+	{
+		int index = paragraphIndexes[paragraph] - paragraphIndexBase;
+		if(paragraph >= paragraphShiftStart)
+		{
+			index += paragraphIndexShift;
+		}
+
+		return index;
+	}
+
+	int TextBox::getParagraphAtIndex( int index ) const
+	{
+		//the last paragraph that starts at or before index
+		int low = 0;
+		int high = int(paragraphIndexes.size());
+		while(low < high)
+		{
+			int mid = (low + high) / 2;
+			if(getParagraphIndex(mid) <= index)
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid;
+			}
+		}
+
+		return low - 1;
+	}
+
+	int TextBox::getParagraphAtRow( int row ) const
+	{
+		int low = 0;
+		int high = int(paragraphRows.size());
+		while(low < high)
+		{
+			int mid = (low + high) / 2;
+			if(getParagraphRow(mid) <= row)
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid;
+			}
+		}
+
+		return low - 1;
+	}
+
+	int TextBox::getRowStart( int row ) const
+	{
+		return getParagraphIndex(getParagraphAtRow(row)) + rowOffsets[row];
+	}
+
+	std::string TextBox::getRowText( int row, int length ) const
+	{
+		if(length > rowLengths[row])
+		{
+			length = rowLengths[row];
 		}
+
+		return textBuffer.getSubString(getRowStart(row),length);
+	}
+
+	void TextBox::setPendingEdit( int index, int removedLength, int insertedLength )
+	{
+		hasPendingEdit = true;
+		pendingEditIndex = index;
+		pendingEditRemoved = removedLength;
+		pendingEditInserted = insertedLength;
 	}
 
 	void TextBox::setWheelScrollRate( int rate )
@@ -749,30 +1052,32 @@ namespace agui {
 
 	void TextBox::relocateCaret()
 	{
-		if(caretRow >= (int)textRows.size())
+		invalidate();
+
+		if(rowLengths.size() <= 0)
+		{
+			caretColumnLocation = getHorizontalOffset();
+			caretRowLocation = getVerticalOffset();
+			return;
+		}
+		if(caretRow >= (int)rowLengths.size())
 		{
-			caretRow = int(textRows.size()) - 1;
-			int rowLen = int(unicodeFunctions.length(textRows[caretRow]));
+			caretRow = int(rowLengths.size()) - 1;
+			int rowLen = rowLengths[caretRow];
 			if(caretColumn > rowLen)
 			{
 				caretColumn = rowLen;
 			}
 		}
-		if(textRows.size() <= 0)
-		{
-			caretColumnLocation = getHorizontalOffset();
-			caretRowLocation = getVerticalOffset();
-			return;
-		}
-		caretColumnLocation = getTextWidth(unicodeFunctions.subStr(textRows[getCaretRow()],
-			0,getCaretColumn())) + getHorizontalOffset() + getLineOffset(getCaretRow());
+		caretColumnLocation = getTextWidth(getRowText(getCaretRow(),
+			getCaretColumn())) + getHorizontalOffset() + getLineOffset(getCaretRow());
 
 		caretRowLocation = getVerticalOffset() + (getCaretRow() * getLineHeight());
 	}
 
 	void TextBox::positionCaret( int column, int row)
 	{
-		if(textRows.empty())
+		if(rowLengths.empty())
 		{
 			caretRow = 0;
 			caretColumn = 0;
@@ -782,20 +1087,20 @@ namespace agui {
 			return;
 		}
 
-		if(caretRow >= (int)textRows.size())
+		if(caretRow >= (int)rowLengths.size())
 		{
-			caretRow = int(textRows.size() - 1);
-			int rowLen = int(unicodeFunctions.length(textRows[caretRow]));
+			caretRow = int(rowLengths.size() - 1);
+			int rowLen = rowLengths[caretRow];
 			if(caretColumn > rowLen)
 			{
 				caretColumn = rowLen;
 			}
 		}
 
-			if(row >= (int)textRows.size())
+			if(row >= (int)rowLengths.size())
 			{
 
-				row = (int)textRows.size() - 1;
+				row = (int)rowLengths.size() - 1;
 			}
 			if(row < 0)
 			{
@@ -803,9 +1108,9 @@ namespace agui {
 			}
 
 
-			if(column > (int)unicodeFunctions.length(textRows[row]))
+			if(column > rowLengths[row])
 			{
-				column = (int)unicodeFunctions.length(textRows[row]);
+				column = rowLengths[row];
 			}
 
 			if(column < 0)
@@ -861,34 +1166,36 @@ namespace agui {
 			return;
 		}
 
+		std::string caretLine = getTextLineAt(getCaretRow());
+
 		//do we need to move?
-		if(getTextWidth(unicodeFunctions.subStr(textRows[getCaretRow()],
+		if(getTextWidth(unicodeFunctions.subStr(caretLine,
 			0,getCaretColumn())) > pChildHScroll->getValue() + getAdjustedWidth()
 			- vscrollOffset)
 		{
 
 			//scroll to end
-			if((int)unicodeFunctions.length(textRows[getCaretRow()]) < getCaretColumn() + maxSkip)
+			if(rowLengths[getCaretRow()] < getCaretColumn() + maxSkip)
 			{
 
-				retOffset += getTextWidth(textRows[getCaretRow()]) - getAdjustedWidth() + vscrollOffset; 
+				retOffset += getTextWidth(caretLine) - getAdjustedWidth() + vscrollOffset; 
 			}
 			else
 			{
-				retOffset += getTextWidth(unicodeFunctions.subStr(textRows[getCaretRow()],
+				retOffset += getTextWidth(unicodeFunctions.subStr(caretLine,
 					0, getCaretColumn() + maxSkip )) - getAdjustedWidth() + vscrollOffset;
 			}
 
 			pChildHScroll->setValue(retOffset);
 
 		}
-		else if(-pChildHScroll->getValue() + getTextWidth(unicodeFunctions.subStr(textRows[getCaretRow()],
+		else if(-pChildHScroll->getValue() + getTextWidth(unicodeFunctions.subStr(caretLine,
 			0,getCaretColumn())) <= leftPadding)
 		{
 
 			if(getCaretColumn() - maxSkip > 0)
 			{
-				retOffset += getTextWidth(unicodeFunctions.subStr(textRows[getCaretRow()],
+				retOffset += getTextWidth(unicodeFunctions.subStr(caretLine,
 					0, getCaretColumn() - maxSkip )) ;
 			}
 
@@ -901,6 +1208,7 @@ namespace agui {
 	{
 		horizontalOffset = -pChildHScroll->getValue() + getLeftPadding();
 		verticalOffset = -pChildVScroll->getValue() + getTopPadding();
+		invalidate();
 	}
 
 	void TextBox::keyDown( KeyEvent &keyEvent )
@@ -912,9 +1220,9 @@ namespace agui {
 	{
 		//used to make the caret descent or ascent look natural
 
-		int oldRowWidth = getTextWidth(unicodeFunctions.subStr(textRows[row],0,column));
+		int oldRowWidth = getTextWidth(getRowText(row,column));
 
-		return getFont()->getStringIndexFromPosition(textRows[newRow],oldRowWidth + getLineOffset(row) - getLineOffset(newRow));
+		return getFont()->getStringIndexFromPosition(getTextLineAt(newRow),oldRowWidth + getLineOffset(row) - getLineOffset(newRow));
 	}
 
 	void TextBox::keyRepeat( KeyEvent &keyEvent )
@@ -972,21 +1280,26 @@ namespace agui {
 		int column = 0;
 
 
-		if(row >= (int)textRows.size())
+		if(row >= (int)rowLengths.size())
 		{
-			row = (int)(textRows.size() - 1);
+			row = (int)(rowLengths.size() - 1);
 		}
 
 		if(row < 0)
 		{
 			row = 0;
 		}
+
+		if(rowLengths.empty())
+		{
+			return Point(0,0);
+		}
 		x -= getLeftPadding();
 		x -= getMargin(SIDE_LEFT);
 		x += pChildHScroll->getValue();
 		x -= getLineOffset(row);
 
-		column = getFont()->getStringIndexFromPosition(textRows[row],x);
+		column = getFont()->getStringIndexFromPosition(getTextLineAt(row),x);
 		return Point(column,row);
 
 	}
@@ -1003,135 +1316,54 @@ namespace agui {
 
 	int TextBox::indexFromColumnRow( int column, int row) const
 	{
-		size_t rowLen = 0;
-
-		int retIndex = -1;
-		int bytesSkipped = 0;
-		int curCharLen = 0;
-		size_t ind = 0;
-
-		
 		//decrement column so that the lowest is -1
 		column--;
-		if(textRows.size() == 0 || (column == -1 && row == 0))
+		if(rowLengths.size() == 0 || (column == -1 && row == 0))
 		{
 			//not in the text
 			return -1;
 		}
-		for(size_t i = 0; i < textRows.size(); ++i)
-		{
-			//get length of row
-			rowLen = rowLen = rowLengths[i];
-
-			//handle -1th case
-
-			//get next character
-		
-				curCharLen = int(unicodeFunctions.bringToNextUnichar(ind,getText()));
-				//only increase for newlines
-				if(getText()[bytesSkipped] != '\n')
-				{
-					bytesSkipped -= curCharLen;
-					ind -= curCharLen;
-				}
-				else
-				{
-					retIndex++;
-				}
-
 
-				bytesSkipped += curCharLen;
-
-		
-			if((int)i == row && column == -1)
-			{
-				return retIndex;
-			}
-
-			
-			for(size_t j = 0; j < rowLen; ++j)
-			{
-				//get next character
-			
-					curCharLen = int(unicodeFunctions.bringToNextUnichar(ind,getText()));
-					bytesSkipped += curCharLen;
-
-					retIndex++;
-
-				if((int)i == row && (int)j == column)
-				{
-					return retIndex;
-				}
-			}
+		if(row >= 0 && row < (int)rowLengths.size() &&
+			column >= -1 && column < rowLengths[row])
+		{
+			return getRowStart(row) + column;
 		}
 
-		return retIndex;
+		return getTextLength() - 1;
 	}
 
 	Point TextBox::columnRowFromIndex( int index) const
 	{
-		size_t rowLen = 0;
-
-		int retIndex = -1;
-		size_t bytesSkipped = 0;
-		size_t curCharLen = 0;
-		size_t ind = 0;
-
-		if(textRows.size() == 0 || index == -1)
+		if(rowLengths.size() == 0 || index == -1)
 		{
 			//not in the text
 			return Point(0,0);
 		}
-		for(size_t i = 0; i < textRows.size(); ++i)
-		{
-			//get length of row
-			rowLen = rowLengths[i];
-
-		
-			if(index == retIndex)
-			{
-				return Point(0, int(i));
-			}
-
-
-			for(size_t j = 0; j < rowLen; ++j)
-			{
-				//get next character
-					curCharLen = unicodeFunctions.bringToNextUnichar(ind, getText());
-					bytesSkipped += curCharLen;
-
-					retIndex++;
-
-				if(retIndex == index)
-				{
-					return Point(int(j + 1) , int(i));
-				}
-			}
 
-			//handle -1th case
+		if(index >= 0 && index < getTextLength())
+		{
+			//the paragraph whose newline (or the end) comes after index
+			int paragraph = getParagraphAtIndex(index + 1);
 
-			//get next character
-				curCharLen = unicodeFunctions.bringToNextUnichar(ind, getText());
+			int firstRow = getParagraphRow(paragraph);
+			int lastRow = paragraph + 1 < (int)paragraphRows.size() ?
+				getParagraphRow(paragraph + 1) : int(rowLengths.size());
 
-				//only increase for newlines
-				if(getText()[bytesSkipped] != '\n')
-				{
-					bytesSkipped -= curCharLen;
-					retIndex--;
-					ind -= curCharLen;
-				}
-				bytesSkipped += curCharLen;
-				retIndex++;
+			//the first row of the paragraph that ends after index
+			int local = index - getParagraphIndex(paragraph);
+			int row = int(std::upper_bound(rowOffsets.begin() + firstRow + 1,
+				rowOffsets.begin() + lastRow,local) - rowOffsets.begin()) - 1;
 
-			
+			return Point(local + 1 - rowOffsets[row], row);
 		}
 
-		return Point(int(rowLen) , int(textRows.size() - 1));
+		return Point(rowLengths.back() , int(rowLengths.size() - 1));
 	}
 
 	void TextBox::mousePositionCaret(const Point& pos ) 
 	{
-		if(textRows.empty())
+		if(rowLengths.empty())
 		{
 			caretRow = 0;
 			caretColumn = 0;
@@ -1149,7 +1381,7 @@ namespace agui {
 
 	void TextBox::keyPositionCaret( int column, int row)
 	{
-		if(textRows.empty())
+		if(rowLengths.empty())
 		{
 			caretRow = 0;
 			caretColumn = 0;
@@ -1159,9 +1391,9 @@ namespace agui {
 			return;
 		}
 
-		if(caretRow >= (int)textRows.size())
+		if(caretRow >= (int)rowLengths.size())
 		{
-			caretRow = int(textRows.size()) - 1;
+			caretRow = int(rowLengths.size()) - 1;
 			int rowLen = getRowLength(caretRow);
 			if(caretColumn > rowLen)
 			{
@@ -1169,10 +1401,10 @@ namespace agui {
 			}
 		}
 
-		if(row >= (int)textRows.size())
+		if(row >= (int)rowLengths.size())
 		{
 
-			row = (int)textRows.size() - 1;
+			row = (int)rowLengths.size() - 1;
 		}
 		if(row < 0)
 		{
@@ -1183,7 +1415,7 @@ namespace agui {
 
 		if( isWordWrap() && isStandardArrowKeyRules() && row == caretRow && 
 			column > getRowLength(caretRow) - 1 &&
-			row + 1 < (int)textRows.size() &&
+			row + 1 < (int)rowLengths.size() &&
 			getRowLength(caretRow) > 0)
 		{
 			if(column > 0)
@@ -1199,7 +1431,7 @@ namespace agui {
 					(getTextLineAt(row)[getTextLineAt(row).length() - 1] != '\n'))
 				{
 					int ind = indexFromColumnRow(getRowLength(caretRow),caretRow) + 1;
-					if(ind < getTextLength() && unicodeFunctions.subStr(getText(),ind,1) == "\n")
+					if(ind < getTextLength() && textBuffer.isNewline(ind))
 					{
 						column = 0;
 					}
@@ -1225,7 +1457,7 @@ namespace agui {
 				(getTextLineAt(row)[getTextLineAt(row).length() - 1] != '\n'))
 			{
 				int ind = indexFromColumnRow(getRowLength(row),row) + 1;
-				if(ind < getTextLength() && unicodeFunctions.subStr(getText(),ind,1) == "\n")
+				if(ind < getTextLength() && textBuffer.isNewline(ind))
 				{
 					column = getRowLength(row);
 				}
@@ -1241,7 +1473,7 @@ namespace agui {
 			
 		}
 		else if (column > getRowLength(caretRow) &&
-			row + 1 < (int)textRows.size())
+			row + 1 < (int)rowLengths.size())
 		{
 			if(column > 0)
 			{
@@ -1279,7 +1511,7 @@ namespace agui {
 
 	void TextBox::sizePositionCaret(const Point& pos )
 	{
-		if(textRows.empty())
+		if(rowLengths.empty())
 		{
 			caretRow = 0;
 			caretColumn = 0;
@@ -1305,9 +1537,10 @@ namespace agui {
 
 		int h = 0;
 		int curH = 0;
-		for(int i = 0; i < (int)textRows.size(); ++i)
+		bool measured = rowWidths.size() == rowLengths.size();
+		for(int i = 0; i < (int)rowLengths.size(); ++i)
 		{
-			curH = getTextWidth(textRows[i]);
+			curH = measured ? rowWidths[i] : getTextWidth(getTextLineAt(i));
 			if(curH > h)
 			{
 				h = curH;
@@ -1448,7 +1681,7 @@ namespace agui {
 
 	int TextBox::removeLastCharacter()
 	{
-			if(getText().length() == 0)
+			if(getTextLength() == 0)
 			{
 				return -1;
 			}
@@ -1456,9 +1689,7 @@ namespace agui {
 			int index = indexFromColumnRow(getCaretColumn(),getCaretRow());
 			if(index < getTextLength() && index >= 0)
 			{
-				std::string *text = (std::string*)&getText();
-				unicodeFunctions.erase(*text,index,1);
-				setThisText(*text);
+				editText(index,1,"");
 			
 				index--;
 
@@ -1475,7 +1706,7 @@ namespace agui {
 
 	int TextBox::removeNextCharacter()
 	{
-		if(getText().length() == 0)
+		if(getTextLength() == 0)
 		{
 			return -1;
 		}
@@ -1490,9 +1721,7 @@ namespace agui {
 			return -1;
 		}
 
-		std::string text = getText();
-		unicodeFunctions.erase(text,index,1);
-		setThisText(text);
+		editText(index,1,"");
 		Point p = columnRowFromIndex(startIndex);
 		sizePositionCaret(p);
 
@@ -1515,13 +1744,10 @@ namespace agui {
 		{
 			return -1;
 		}
-		std::string *text = (std::string *)&getText();
-		
 		int index = indexFromColumnRow(getCaretColumn(),getCaretRow());
 
 		index++;
-		unicodeFunctions.insert(*text,index,character);
-		setThisText(*text);
+		editText(index,0,character);
 
 		Point p = columnRowFromIndex(index);
 
@@ -1543,6 +1769,7 @@ namespace agui {
 		}
 
 		this->readOnly = readOnly;
+		invalidate();
 		for(std::vector<TextBoxListener*>::iterator it = 
 			textBoxListeners.begin();
 			it != textBoxListeners.end(); ++it)
@@ -1560,6 +1787,7 @@ namespace agui {
 	void TextBox::setDrawBorder( bool drawBorder )
 	{
 		this->drawBorder = drawBorder;
+		invalidate();
 	}
 
 	void TextBox::setMaxCharacterSkip( int val )
@@ -1678,6 +1906,8 @@ namespace agui {
 			}
 		}
 
+		invalidate();
+
 		//no selection
 		if(startIndex == endIndex)
 		{
@@ -1755,7 +1985,7 @@ namespace agui {
 			//only an end position for the last row
 			if(i < endColRow.getY())
 			{
-				colEnd = int(unicodeFunctions.length(textRows[i]));
+				colEnd = rowLengths[i];
 			}
 			else
 			{
@@ -1763,11 +1993,10 @@ namespace agui {
 			}
 
 			//top left
-			if(textRows[i].length() > 0)
+			if(rowLengths[i] > 0)
 			{
 				selPts.back().first = Point(
-					getTextWidth(unicodeFunctions.subStr(
-					textRows[i],0,colBegin)) + lineOffset[i],
+					getTextWidth(getRowText(i,colBegin)) + lineOffset[i],
 					getLineHeight() * i );
 			}
 			else //render newline as space
@@ -1779,8 +2008,7 @@ namespace agui {
 		
 			//bottom right
 			selPts.back().second = Point(
-				getTextWidth(unicodeFunctions.subStr(
-				textRows[i],0,colEnd)) - selPts.back().first.getX() + lineOffset[i],
+				getTextWidth(getRowText(i,colEnd)) - selPts.back().first.getX() + lineOffset[i],
 				(getLineHeight()));
 		}
 
@@ -1810,13 +2038,9 @@ namespace agui {
 			return;
 		}
 
-		std::string *text = (std::string*)&getText();
-		unicodeFunctions.erase(*text,getSelectionStart() ,
-			getSelectionEnd() - getSelectionStart());
-
 		Point cr = columnRowFromIndex(getSelectionStart() - 1);
 
-		setThisText(*text);
+		editText(getSelectionStart(),getSelectionLength(),"");
 		mousePositionCaret(cr);
 
 		for(std::vector<TextBoxListener*>::iterator it = 
@@ -1875,12 +2099,12 @@ namespace agui {
 
 	int TextBox::getTextLineCount() const
 	{
-		return int(textRows.size());
+		return int(rowLengths.size());
 	}
 
-	const std::string& TextBox::getTextLineAt( int line ) const
+	std::string TextBox::getTextLineAt( int line ) const
 	{
-		return textRows[line];
+		return getRowText(line,rowLengths[line]);
 	}
 
 	bool TextBox::isHScrollVisible() const
@@ -2022,29 +2246,40 @@ namespace agui {
 		{
 			index = getTextLength();
 		}
+
+		bool followText = isAutoScrolling() && !repositionCaret &&
+			pChildVScroll->getValue() >= pChildVScroll->getMaxValue() -
+			pChildVScroll->getLargeAmount();
 	
 		//ensure we don't go over the max length
-		std::string *txt = (std::string*)&getText();
 		if(numRemainingChar < length)
 		{
 			std::string shrunk = text;
 			shrunk = unicodeFunctions.subStr(shrunk,0,numRemainingChar);
 			length = numRemainingChar;
-			unicodeFunctions.insert(*txt,index,shrunk);
+			editText(int(index),0,shrunk);
 		}
 		else
 		{
-			unicodeFunctions.insert(*txt,index,text);
+			editText(int(index),0,text);
 		}
-		
-		setThisText(*txt);
+
+		int trimmed = trimLines();
 
 		if(repositionCaret)
 		{
 			int len = int(unicodeFunctions.length(text));
-			int newIndex = int(index - 1) + len;
+			int newIndex = int(index - 1) + len - trimmed;
+			if(newIndex < -1)
+			{
+				newIndex = -1;
+			}
 			mousePositionCaret(columnRowFromIndex(newIndex));
 		}
+		else if(followText)
+		{
+			pChildVScroll->setValue(pChildVScroll->getMaxValue());
+		}
 
 		for(std::vector<TextBoxListener*>::iterator it = 
 			textBoxListeners.begin();
@@ -2061,7 +2296,7 @@ namespace agui {
 		{
 			return "";
 		}
-		return unicodeFunctions.subStr(getText(),getSelectionStart() ,getSelectionLength());
+		return textBuffer.getSubString(getSelectionStart() ,getSelectionLength());
 	}
 
 	int TextBox::getSelectionLength() const
@@ -2105,17 +2340,21 @@ namespace agui {
 
 	void TextBox::logic( double timeElapsed )
 	{
-		processBlinkEvent(timeElapsed);
+		if(processBlinkEvent(timeElapsed) && isFocused())
+		{
+			invalidate();
+		}
 	}
 
 	int TextBox::getTextWidth( const std::string &text ) const
 	{
-		return getFont()->getTextWidth(text);
+		return getFont()->getTextAdvance(text);
 	}
 
 	void TextBox::setSelectionBackColor( const Color &color )
 	{
 		selectionBackColor = color;
+		invalidate();
 	}
 
 	const Color& TextBox::getSelectionBackColor() const
@@ -2151,6 +2390,7 @@ namespace agui {
 			return;
 		}
 		hideSelection = hide;
+		invalidate();
 
 		for(std::vector<TextBoxListener*>::iterator it = 
 			textBoxListeners.begin();
@@ -2168,6 +2408,59 @@ namespace agui {
 		selfSetText = false;
 	}
 
+	void TextBox::setBufferText( const std::string &text )
+	{
+		//truncate string if it is too long
+		if((int)unicodeFunctions.length(text) > getMaxLength())
+		{
+			textBuffer.setText(unicodeFunctions.subStr(text,0,getMaxLength()));
+		}
+		else
+		{
+			textBuffer.setText(text);
+		}
+
+		dispatchTextChangedEvent();
+	}
+
+	void TextBox::editText( int index, int removedLength, const std::string &text )
+	{
+		int oldLength = getTextLength();
+		textBuffer.erase(index,removedLength);
+		textBuffer.insert(index,text);
+
+		//truncate string if it is too long
+		if(getTextLength() > getMaxLength())
+		{
+			textBuffer.erase(getMaxLength(),getTextLength() - getMaxLength());
+		}
+
+		setPendingEdit(index,removedLength,int(unicodeFunctions.length(text)));
+
+		selfSetText = true;
+		dispatchTextEditedEvent(index,removedLength,
+			getTextLength() - oldLength + removedLength);
+		updateText();
+		updateScrollBars();
+		setSelection(0,0);
+		selfSetText = false;
+	}
+
+	const TextBuffer& TextBox::getTextBuffer() const
+	{
+		return textBuffer;
+	}
+
+	const std::string& TextBox::getText() const
+	{
+		return textBuffer.getString();
+	}
+
+	int TextBox::getTextLength() const
+	{
+		return textBuffer.getLength();
+	}
+
 	bool TextBox::isSelfSettingText() const
 	{
 		return selfSetText;
@@ -2192,6 +2485,140 @@ namespace agui {
 		}
 	}
 
+	int TextBox::getMaxLineCount() const
+	{
+		return maxLineCount;
+	}
+
+	void TextBox::setMaxLineCount( int count )
+	{
+		if(count < 0)
+		{
+			count = 0;
+		}
+
+		maxLineCount = count;
+		trimLines();
+	}
+
+	bool TextBox::isAutoScrolling() const
+	{
+		return autoScrolling;
+	}
+
+	void TextBox::setAutoScrolling( bool autoScroll )
+	{
+		autoScrolling = autoScroll;
+	}
+
+	int TextBox::trimLines()
+	{
+		//a newline at the end starts a line that has no text yet
+		int lineCount = int(paragraphIndexes.size());
+		if(getTextLength() > 0 && textBuffer.isNewline(getTextLength() - 1))
+		{
+			lineCount--;
+		}
+
+		int numLines = lineCount - getMaxLineCount();
+		if(getMaxLineCount() <= 0 || numLines <= 0 ||
+			hasPendingEdit || layoutLength != getTextLength())
+		{
+			return 0;
+		}
+
+		//remove the lines and their newlines without laying out what is kept
+		int length = getParagraphIndex(numLines);
+		int numRows = getParagraphRow(numLines);
+		int scroll = pChildVScroll->getValue();
+
+		textBuffer.erase(0,length);
+
+		bool rescanWidest = false;
+		if(!isWordWrap())
+		{
+			for(int i = 0; i < numRows; ++i)
+			{
+				if(rowWidths[i] >= widestLine)
+				{
+					rescanWidest = true;
+					break;
+				}
+			}
+
+			rowWidths.erase(rowWidths.begin(),rowWidths.begin() + numRows);
+		}
+
+		rowLengths.erase(rowLengths.begin(),rowLengths.begin() + numRows);
+		rowOffsets.erase(rowOffsets.begin(),rowOffsets.begin() + numRows);
+		lineOffset.erase(lineOffset.begin(),lineOffset.begin() + numRows);
+		paragraphRows.erase(paragraphRows.begin(),paragraphRows.begin() + numLines);
+		paragraphIndexes.erase(paragraphIndexes.begin(),paragraphIndexes.begin() + numLines);
+		paragraphShiftStart = paragraphShiftStart > numLines ?
+			paragraphShiftStart - numLines : 0;
+
+		//the paragraphs that are kept are not shifted, their bases are
+		paragraphRowBase += numRows;
+		paragraphIndexBase += length;
+
+		//shift them once as much text was removed as is kept so they cannot overflow
+		if(paragraphIndexBase >= getTextLength())
+		{
+			for(size_t i = 0; i < paragraphRows.size(); ++i)
+			{
+				paragraphRows[i] -= paragraphRowBase;
+				paragraphIndexes[i] -= paragraphIndexBase;
+			}
+
+			paragraphRowBase = 0;
+			paragraphIndexBase = 0;
+		}
+
+		layoutLength = getTextLength();
+
+		//no row got wider so the scan can stop at one as wide as the old widest
+		if(rescanWidest)
+		{
+			int widest = 0;
+			for(size_t i = 0; i < rowWidths.size() && widest < widestLine; ++i)
+			{
+				if(rowWidths[i] > widest)
+				{
+					widest = rowWidths[i];
+				}
+			}
+
+			widestLine = widest;
+		}
+
+		selfSetText = true;
+		dispatchTextEditedEvent(0,length,0);
+		setSelection(0,0);
+		selfSetText = false;
+
+		updateScrollBars();
+
+		//the Vscroll bar may have been hidden, which changes the wrap width
+		if(layoutWidth != getWrapWidth())
+		{
+			updateText();
+			updateScrollBars();
+		}
+
+		//keep showing the same text
+		pChildVScroll->setValue(scroll - (numRows * getLineHeight()));
+
+		caretRow -= numRows;
+		if(caretRow < 0)
+		{
+			caretRow = 0;
+			caretColumn = 0;
+		}
+		relocateCaret();
+
+		return length;
+	}
+
 	void TextBox::addTextBoxListener( TextBoxListener* listener )
 	{
 		if(!listener)
@@ -0,0 +1,343 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/Widgets/TextBox/TextStyleRuns.hpp"
+
+namespace agui
+{
+	TextStyleRuns::TextStyleRuns()
+		: root(NULL), runCount(0), seed(0x2545F491)
+	{
+	}
+
+	TextStyleRuns::~TextStyleRuns()
+	{
+		destroy(root);
+	}
+
+	TextStyleRuns::Node* TextStyleRuns::createNode( const Color &color,
+		Image* image, int length )
+	{
+		//a small linear congruential generator keeps the tree balanced
+		seed = seed * 1103515245 + 12345;
+
+		Node* node = new Node;
+		node->color = color;
+		node->image = image;
+		node->length = length;
+		node->total = length;
+		node->priority = seed;
+		node->left = NULL;
+		node->right = NULL;
+		runCount++;
+		return node;
+	}
+
+	void TextStyleRuns::destroy( Node* node )
+	{
+		if(!node)
+		{
+			return;
+		}
+
+		destroy(node->left);
+		destroy(node->right);
+		delete node;
+		runCount--;
+	}
+
+	int TextStyleRuns::getTotal( const Node* node )
+	{
+		return node ? node->total : 0;
+	}
+
+	void TextStyleRuns::update( Node* node )
+	{
+		node->total = getTotal(node->left) + node->length + getTotal(node->right);
+	}
+
+	TextStyleRuns::Node* TextStyleRuns::merge( Node* left, Node* right )
+	{
+		if(!left)
+		{
+			return right;
+		}
+		if(!right)
+		{
+			return left;
+		}
+
+		if(left->priority > right->priority)
+		{
+			left->right = merge(left->right,right);
+			update(left);
+			return left;
+		}
+
+		right->left = merge(left,right->left);
+		update(right);
+		return right;
+	}
+
+	void TextStyleRuns::split( Node* node, int index, Node* &left, Node* &right )
+	{
+		if(!node)
+		{
+			left = NULL;
+			right = NULL;
+			return;
+		}
+
+		int leftTotal = getTotal(node->left);
+
+		if(index <= leftTotal)
+		{
+			split(node->left,index,left,node->left);
+			update(node);
+			right = node;
+		}
+		else if(index >= leftTotal + node->length)
+		{
+			split(node->right,index - leftTotal - node->length,node->right,right);
+			update(node);
+			left = node;
+		}
+		else
+		{
+			//the index is inside of this run, cut it in two
+			int offset = index - leftTotal;
+			Node* tail = createNode(node->color,node->image,node->length - offset);
+			Node* rest = node->right;
+
+			node->length = offset;
+			node->right = NULL;
+			update(node);
+
+			left = node;
+			right = merge(tail,rest);
+		}
+	}
+
+	void TextStyleRuns::recolor( Node* node, const Color &color )
+	{
+		if(!node)
+		{
+			return;
+		}
+
+		node->color = color;
+		recolor(node->left,color);
+		recolor(node->right,color);
+	}
+
+	void TextStyleRuns::grow( Node* node, int index, int count )
+	{
+		//lengthens the run that holds index
+		int leftTotal = getTotal(node->left);
+
+		if(index < leftTotal)
+		{
+			grow(node->left,index,count);
+		}
+		else if(index < leftTotal + node->length)
+		{
+			node->length += count;
+		}
+		else
+		{
+			grow(node->right,index - leftTotal - node->length,count);
+		}
+
+		update(node);
+	}
+
+	bool TextStyleRuns::isSameStyle( const Color &color, Image* image,
+		const Color &otherColor, Image* otherImage )
+	{
+		Color c = color;
+		return image == otherImage && c == otherColor;
+	}
+
+	void TextStyleRuns::insert( int index, int count, const Color &color, Image* image )
+	{
+		if(count <= 0)
+		{
+			return;
+		}
+
+		if(index < 0)
+		{
+			index = 0;
+		}
+		if(index > getLength())
+		{
+			index = getLength();
+		}
+
+		Color runColor;
+		Image* runImage = NULL;
+
+		//join the run before or after the insertion point
+		if(index > 0 && getRun(index - 1,runColor,runImage) > 0 &&
+			isSameStyle(color,image,runColor,runImage))
+		{
+			grow(root,index - 1,count);
+			return;
+		}
+
+		if(getRun(index,runColor,runImage) > 0 &&
+			isSameStyle(color,image,runColor,runImage))
+		{
+			grow(root,index,count);
+			return;
+		}
+
+		Node* left = NULL;
+		Node* right = NULL;
+		split(root,index,left,right);
+		root = merge(merge(left,createNode(color,image,count)),right);
+	}
+
+	void TextStyleRuns::erase( int index, int count )
+	{
+		if(index < 0)
+		{
+			count += index;
+			index = 0;
+		}
+		if(count <= 0 || index >= getLength())
+		{
+			return;
+		}
+
+		Node* left = NULL;
+		Node* middle = NULL;
+		Node* right = NULL;
+		split(root,index,left,middle);
+		split(middle,count,middle,right);
+		destroy(middle);
+		root = merge(left,right);
+	}
+
+	void TextStyleRuns::setColor( int index, int count, const Color &color )
+	{
+		if(index < 0)
+		{
+			count += index;
+			index = 0;
+		}
+		if(count <= 0 || index >= getLength())
+		{
+			return;
+		}
+
+		Node* left = NULL;
+		Node* middle = NULL;
+		Node* right = NULL;
+		split(root,index,left,middle);
+		split(middle,count,middle,right);
+		recolor(middle,color);
+		root = merge(merge(left,middle),right);
+	}
+
+	int TextStyleRuns::getRun( int index, Color &color, Image* &image ) const
+	{
+		if(index < 0 || index >= getLength())
+		{
+			return 0;
+		}
+
+		const Node* node = root;
+		while(node)
+		{
+			int leftTotal = getTotal(node->left);
+
+			if(index < leftTotal)
+			{
+				node = node->left;
+			}
+			else if(index < leftTotal + node->length)
+			{
+				color = node->color;
+				image = node->image;
+				return leftTotal + node->length - index;
+			}
+			else
+			{
+				index -= leftTotal + node->length;
+				node = node->right;
+			}
+		}
+
+		return 0;
+	}
+
+	Color TextStyleRuns::getColorAt( int index ) const
+	{
+		Color color;
+		Image* image = NULL;
+		getRun(index,color,image);
+		return color;
+	}
+
+	Image* TextStyleRuns::getImageAt( int index ) const
+	{
+		Color color;
+		Image* image = NULL;
+		getRun(index,color,image);
+		return image;
+	}
+
+	int TextStyleRuns::getLength() const
+	{
+		return getTotal(root);
+	}
+
+	int TextStyleRuns::getRunCount() const
+	{
+		return runCount;
+	}
+
+	void TextStyleRuns::clear()
+	{
+		destroy(root);
+		root = NULL;
+	}
+}
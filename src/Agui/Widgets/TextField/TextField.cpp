@@ -167,7 +167,7 @@ namespace agui {
 	{
 		int retOffset = getLeftPadding();
 		
-		int textWidth = getFont()->getTextWidth(getText());
+		int textWidth = getPrefixWidth(getTextLength());
 		if(textWidth < getAdjustedWidth())
 		{
 			switch(getTextAlignment())
@@ -201,8 +201,7 @@ namespace agui {
 		if(reposition)
 		{
 			//do we need to move?
-			if(getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-				0,getCaretPosition())) > -tOffset + getAdjustedWidth() + getLeftPadding()
+			if(getPrefixWidth(getCaretPosition()) > -tOffset + getAdjustedWidth() + getLeftPadding()
 				
 				)
 			{
@@ -211,14 +210,14 @@ namespace agui {
 				if(getTextLength() < getCaretPosition() + getMaxCharacterSkip())
 				{
 
-					retOffset -= solveCaretRetPos(getFont()->getTextWidth(getText())
+					retOffset -= solveCaretRetPos(getPrefixWidth(getTextLength())
 						- getAdjustedWidth(),
 						retOffset);
 				}
 				else
 				{
-					int initialPlace = getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-						0, getCaretPosition() + getMaxCharacterSkip() )) - getAdjustedWidth();
+					int initialPlace = getPrefixWidth(
+						getCaretPosition() + getMaxCharacterSkip()) - getAdjustedWidth();
 					retOffset -= solveCaretRetPos(initialPlace,retOffset);
 					
 				}
@@ -230,14 +229,13 @@ namespace agui {
 				return;
 
 			}
-			else if(tOffset + getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-				0,getCaretPosition())) <= leftPadding)
+			else if(tOffset + getPrefixWidth(getCaretPosition()) <= leftPadding)
 			{
 
 				if(getCaretPosition() - getMaxCharacterSkip() > 0)
 				{
-					int initialPlace = getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-						0, getCaretPosition() - getMaxCharacterSkip() ));
+					int initialPlace = getPrefixWidth(
+						getCaretPosition() - getMaxCharacterSkip());
 					retOffset -= solveCaretRetPos(initialPlace,retOffset);
 
 				}
@@ -249,8 +247,7 @@ namespace agui {
 			else if(negetiveChange )
 			{
 
-				int change = getCaretLocation() - getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-					0, getCaretPosition() )) ;
+				int change = getCaretLocation() - getPrefixWidth(getCaretPosition()) ;
 				if(change <= getLeftPadding())
 				{
 					
@@ -295,13 +292,17 @@ namespace agui {
 
 	void TextField::setTextOffset( int offset )
 	{
+		if(offset != textOffset)
+		{
+			invalidate();
+		}
 		textOffset = offset;
 	}
 
 	void TextField::relocateCaret()
 	{
-		caretLocation = getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-			0,getCaretPosition())) + getTextOffset();
+		caretLocation = getPrefixWidth(getCaretPosition()) + getTextOffset();
+		invalidate();
 	}
 
 	void TextField::removeLastCharacter()
@@ -312,14 +313,7 @@ namespace agui {
 			return;
 		}
 
-		std::string text;
-			if(!isPassword())
-			text = getText();
-			else
-			text = getPassword();
-
-		unicodeFunctions.erase(text,getCaretPosition() - 1,1);
-		setThisText(text);
+		editText(getCaretPosition() - 1,1,"");
 		positionCaret(getCaretPosition() - 1,false);
 
 	}
@@ -331,15 +325,7 @@ namespace agui {
 		{
 			return;
 		}
-		std::string text;
-		if(!isPassword())
-			text = getText();
-		else
-			text = getPassword();
-
-		unicodeFunctions.erase(text,getCaretPosition(),1);
-
-		setThisText(text);
+		editText(getCaretPosition(),1,"");
 		positionCaret(getCaretPosition());
 	}
 
@@ -350,6 +336,88 @@ namespace agui {
 		selfSetText = false;
 	}
 
+	void TextField::editText( int index, int removedLength, const std::string &text )
+	{
+		std::string displayText = text;
+
+		if(isPassword())
+		{
+			if(removedLength > 0)
+			{
+				unicodeFunctions.erase(passwordText,index,removedLength);
+			}
+			unicodeFunctions.insert(passwordText,index,text);
+
+			displayText = "";
+			int length = int(unicodeFunctions.length(text));
+			for(int i = 0; i < length; ++i)
+			{
+				displayText += passwordChar;
+			}
+		}
+
+		textBuffer.erase(index,removedLength);
+		textBuffer.insert(index,displayText);
+		spliceTextWidths(index,removedLength,displayText);
+		invalidatePreferredSize();
+		invalidate();
+
+		selfSetText = true;
+		dispatchTextEditedEvent(index,removedLength,
+			int(unicodeFunctions.length(displayText)));
+		setSelection(0,0);
+		selfSetText = false;
+	}
+
+	void TextField::spliceTextWidths( int index, int removedLength,
+		const std::string &text )
+	{
+		//not measured yet, getPrefixWidths measures everything when needed
+		if(textWidths.empty())
+		{
+			return;
+		}
+
+		if(!getFont() || index < 0 || index >= (int)textWidths.size())
+		{
+			textWidths.clear();
+			return;
+		}
+
+		if(index + removedLength >= (int)textWidths.size())
+		{
+			removedLength = int(textWidths.size()) - 1 - index;
+		}
+
+		std::vector<int> inserted;
+		getFont()->getPrefixWidths(text,inserted);
+
+		int removedWidth = textWidths[index + removedLength] - textWidths[index];
+		int delta = inserted.back() - removedWidth;
+
+		//the widths after the edit only move by the change in width
+		for(size_t i = index + removedLength + 1; i < textWidths.size(); ++i)
+		{
+			textWidths[i] += delta;
+		}
+
+		std::vector<int>::iterator first = textWidths.begin() + index + 1;
+		int insertedLength = int(inserted.size()) - 1;
+		if(insertedLength > removedLength)
+		{
+			textWidths.insert(first,insertedLength - removedLength,0);
+		}
+		else if(insertedLength < removedLength)
+		{
+			textWidths.erase(first,first + (removedLength - insertedLength));
+		}
+
+		for(int i = 1; i <= insertedLength; ++i)
+		{
+			textWidths[index + i] = textWidths[index] + inserted[i];
+		}
+	}
+
 	void TextField::addToNextCharacter( int unichar )
 	{
 		if(getTextLength() + 1 > getMaxLength())
@@ -365,16 +433,8 @@ namespace agui {
 
 		unicodeFunctions.encodeUtf8(buffer,unichar);
 		std::string appendStr = buffer;
-		
-		std::string text;
-		if(!isPassword())
-			text = getText();
-		else
-			text = getPassword();
-
-		unicodeFunctions.insert(text,getCaretPosition(),buffer);
 
-		setThisText(text);
+		editText(getCaretPosition(),0,appendStr);
 		positionCaret(getCaretPosition() + 1);
 
 	}
@@ -417,19 +477,24 @@ namespace agui {
 				passwordText = text;
 			}
 
-				Widget::setText(passText);
+				textBuffer.setText(passText);
 		}
 		else
 		{
 			if(getMaxLength() < (int) unicodeFunctions.length(text))
 			{
-				Widget::setText(unicodeFunctions.subStr(text,0,getMaxLength()));
+				textBuffer.setText(unicodeFunctions.subStr(text,0,getMaxLength()));
 			}
 			else
 			{
-				Widget::setText(text);
+				textBuffer.setText(text);
 			}
 		}
+
+		textWidths.clear();
+		invalidatePreferredSize();
+		invalidate();
+		dispatchTextChangedEvent();
 	
 		
 
@@ -534,13 +599,9 @@ namespace agui {
 				else if(wantedDecimal() && keyEvent.getUnichar() == 0x2e )
 				{
 					//check if there is already a decimal
-					const char *text = getText().c_str();
-					for (int i = 0; i < getTextLength(); ++i)
+					if(textBuffer.contains(0x2e))
 					{
-						if(text[i] == 0x2e)
-						{
-							return;
-						}
+						return;
 					}
 
 					deleteSelection();
@@ -557,13 +618,9 @@ namespace agui {
 					}
 
 					//check if there is already a minus
-					const char *text = getText().c_str();
-					for (int i = 0; i < getTextLength(); ++i)
+					if(textBuffer.contains(0x2d))
 					{
-						if(text[i] == 0x2d)
-						{
-							return;
-						}
+						return;
 					}
 
 					deleteSelection();
@@ -710,9 +767,28 @@ namespace agui {
 		}
 
 
-			paintEvent.graphics()->drawText(Point(textLoc, +
-				((getInnerSize().getHeight() - getFont()->getLineHeight()) / 2)),getText().c_str(),
-				getFontColor(),getFont());
+			//only draw the characters that are inside the clipping rectangle
+			const std::vector<int> &prefixWidths = getPrefixWidths();
+			int firstChar = Font::getStringIndexFromPosition(prefixWidths,
+				sideclip.getLeft() - textLoc) - 1;
+			int lastChar = Font::getStringIndexFromPosition(prefixWidths,
+				sideclip.getRight() - textLoc) + 1;
+			if(firstChar < 0)
+			{
+				firstChar = 0;
+			}
+			if(lastChar > getTextLength())
+			{
+				lastChar = getTextLength();
+			}
+
+			if(lastChar > firstChar)
+			{
+				paintEvent.graphics()->drawText(Point(textLoc + getPrefixWidth(firstChar),
+					((getInnerSize().getHeight() - getFont()->getLineHeight()) / 2)),
+					textBuffer.getSubString(firstChar,lastChar - firstChar).c_str(),
+					getFontColor(),getFont());
+			}
 		
 
 			if(isFocused())
@@ -746,7 +822,7 @@ namespace agui {
 		}
 		dragged = false;
 		int x = mouseEvent.getX() - getTextOffset() - getMargin(SIDE_LEFT);
-		positionCaret(getFont()->getStringIndexFromPosition(getText(),x));
+		positionCaret(Font::getStringIndexFromPosition(getPrefixWidths(),x));
 
 		internalSelStart = getCaretPosition();
 		setSelection(0,0);
@@ -765,6 +841,7 @@ namespace agui {
 	void TextField::setFont( const Font *font )
 	{
 		Widget::setFont(font);
+		textWidths.clear();
 		if(getInnerSize().getHeight() < getFont()->getLineHeight())
 		{
 			setSize(getSize().getWidth(),getFont()->getLineHeight()
@@ -782,7 +859,7 @@ namespace agui {
 
 	void TextField::resizeWidthToContents()
 	{
-		setSize(getFont()->getTextWidth(getText()) + getLeftPadding() + getRightPadding()
+		setSize(getPrefixWidth(getTextLength()) + getLeftPadding() + getRightPadding()
 			+ getMargin(SIDE_LEFT) + getMargin(SIDE_RIGHT),
 			getSize().getHeight());
 		positionCaret(0);
@@ -809,7 +886,7 @@ namespace agui {
 		int maxcharSkip = getMaxCharacterSkip();
 		maxCharacterSkip = 1;
 		int x = mouseEvent.getX() - getTextOffset() - getMargin(SIDE_LEFT);
-		positionCaret(getFont()->getStringIndexFromPosition(getText(),x));
+		positionCaret(Font::getStringIndexFromPosition(getPrefixWidths(),x));
 
 		setSelection(internalSelStart,getCaretPosition());
 		maxCharacterSkip = maxcharSkip;
@@ -881,12 +958,10 @@ namespace agui {
 		selStart = start;
 		selEnd = end;
 		selLength = end - start;
-		selPos = getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-			0,start)) + getTextOffset();
-
-		selWidth = getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-			start,selLength));
+		selPos = getPrefixWidth(start) + getTextOffset();
 
+		selWidth = getPrefixWidth(end) - getPrefixWidth(start);
+		invalidate();
 	}
 
 	int TextField::getSelectionWidth() const
@@ -908,10 +983,8 @@ namespace agui {
 		positionCaret(getSelectionEnd());
 		int e = getSelectionEnd();
 		int s = getSelectionStart();
-		for (int i = e; i > s; i--)
-		{
-			removeLastCharacter();
-		}
+		editText(s,e - s,"");
+		positionCaret(s,false);
 		setSelection(0,0);
 	}
 
@@ -962,6 +1035,7 @@ namespace agui {
 	void TextField::setReadOnly( bool readOny )
 	{
 		this->readOnly = readOny;
+		invalidate();
 		for(std::vector<TextFieldListener*>::iterator it = tFieldListeners.begin();
 			it != tFieldListeners.end(); ++it)
 		{
@@ -1047,6 +1121,7 @@ namespace agui {
 	void TextField::setHideSelection( bool hidden )
 	{
 		hideSelection = hidden;
+		invalidate();
 		for(std::vector<TextFieldListener*>::iterator it = tFieldListeners.begin();
 			it != tFieldListeners.end(); ++it)
 		{
@@ -1062,7 +1137,7 @@ namespace agui {
 		}
 		else
 		{
-			return unicodeFunctions.subStr(getText(),
+			return textBuffer.getSubString(
 				getSelectionStart(),getSelectionLength());
 		}
 	}
@@ -1143,12 +1218,16 @@ namespace agui {
 
 	void TextField::logic( double timeElapsed )
 	{
-		processBlinkEvent(timeElapsed);
+		if(processBlinkEvent(timeElapsed) && isFocused())
+		{
+			invalidate();
+		}
 	}
 
 	void TextField::setSelectionBackColor( const Color &color )
 	{
 		selectionBackColor = color;
+		invalidate();
 	}
 
 	bool TextField::isPassword() const
@@ -1200,6 +1279,42 @@ namespace agui {
 		return passwordText;
 	}
 
+	const std::vector<int>& TextField::getPrefixWidths() const
+	{
+		if(textWidths.empty())
+		{
+			textBuffer.getPrefixWidths(getFont(),textWidths);
+		}
+
+		return textWidths;
+	}
+
+	int TextField::getPrefixWidth( int length ) const
+	{
+		getPrefixWidths();
+
+		if(length < 0)
+		{
+			length = 0;
+		}
+		if(length >= (int)textWidths.size())
+		{
+			length = int(textWidths.size()) - 1;
+		}
+
+		return textWidths[length];
+	}
+
+	const std::string& TextField::getText() const
+	{
+		return textBuffer.getString();
+	}
+
+	int TextField::getTextLength() const
+	{
+		return textBuffer.getLength();
+	}
+
 	void TextField::setSize( const Dimension& size )
 	{
 		Widget::setSize(size);
@@ -1218,14 +1333,12 @@ namespace agui {
 	{
 		int tempResult = retOffset + alignOffset - initialAmount;
 
-		int tempCaret = getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-			0,getCaretPosition())) + tempResult;
+		int tempCaret = getPrefixWidth(getCaretPosition()) + tempResult;
 
 		if(tempCaret > getAdjustedWidth() + getLeftPadding() ||
 			tempCaret < getLeftPadding())
 		{
-			return getFont()->getTextWidth(unicodeFunctions.subStr(getText(),
-				0, getCaretPosition() + 1 )) - getAdjustedWidth();
+			return getPrefixWidth(getCaretPosition() + 1) - getAdjustedWidth();
 		}
 		else
 		{
@@ -1338,9 +1451,7 @@ namespace agui {
 		}
 		if(length > 0)
 		{
-			std::string* cText = (std::string*)&getText();
-			unicodeFunctions.insert(*cText,start,noNewLine);
-			setThisText(*cText);
+			editText(start,0,noNewLine);
 			positionCaret(caretPosition + length);
 		}
 	}
@@ -1378,9 +1489,7 @@ namespace agui {
 		}
 		if(length > 0)
 		{
-			std::string* cText = (std::string*)&getText();
-			unicodeFunctions.insert(*cText,start,noNewLine);
-			setThisText(*cText);
+			editText(start,0,noNewLine);
 			positionCaret(caretPosition + length);
 		}
 	}
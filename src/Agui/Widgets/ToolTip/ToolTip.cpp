@@ -103,6 +103,7 @@ namespace agui {
 
 		setLocation(x,y);
 		setVisibility(true);
+		invalidate();
 	}
 
 	const std::vector<std::string>& ToolTip::getAreaText() const
@@ -127,6 +128,7 @@ namespace agui {
 	void ToolTip::setTextAlignment( AreaAlignmentEnum alignment )
 	{
 		align = alignment;
+		invalidate();
 	}
 
 	agui::AreaAlignmentEnum ToolTip::getTextAlignment() const
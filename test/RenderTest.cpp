@@ -0,0 +1,505 @@
+/*   _____                           
+ * /\  _  \                     __    
+ * \ \ \_\ \      __    __  __ /\_\   
+ *  \ \  __ \   /'_ `\ /\ \/\ \\/\ \  
+ *   \ \ \/\ \ /\ \_\ \\ \ \_\ \\ \ \ 
+ *    \ \_\ \_\\ \____ \\ \____/ \ \_\
+ *     \/_/\/_/ \/____\ \\/___/   \/_/
+ *                /\____/             
+ *                \_/__/              
+ *
+ * Copyright (c) 2011 Joshua Larouche
+ * 
+ *
+ * License: (BSD)
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name of Agui nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Agui/Agui.hpp"
+#include "Agui/Backends/Software/Software.hpp"
+#include "Agui/Widgets/Button/Button.hpp"
+#include "Agui/Widgets/CheckBox/CheckBox.hpp"
+#include "Agui/Widgets/RadioButton/RadioButton.hpp"
+#include "Agui/Widgets/Label/Label.hpp"
+#include "Agui/Widgets/TextField/TextField.hpp"
+#include "Agui/Widgets/TextBox/TextBox.hpp"
+#include "Agui/Widgets/ListBox/ListBox.hpp"
+#include <cstdio>
+#include <vector>
+
+/*
+ * Renders the same scene four ways, with dirty rendering and draw command
+ * batching each on or off, and changes the widgets from code between frames.
+ * Every frame must match the one that was fully repainted. A setter that
+ * changes what a widget paints without invalidating it leaves the old
+ * pixels on screen in the other three. Painting must not add damage,
+ * or the next frame repaints what did not change.
+ *
+ * The last frames change nothing. The batched scenes must replay their
+ * recorded draw commands and the dirty scenes must skip painting, so no
+ * widget may be painted in them.
+ *
+ * Then draws sprites from one atlas page with a rectangle between them,
+ * with sprite batching on and off. The rectangle must end the batch and
+ * the sprites outside of the clipping rectangle must be culled, without
+ * changing any pixel.
+ *
+ * Last, writes pixels through a locked region and checks that they match
+ * single pixel writes and stay inside the region, also on an atlas page.
+ */
+
+namespace
+{
+	class RenderScene
+	{
+		agui::SoftwareGraphics graphics;
+		agui::SoftwareInput input;
+		agui::SoftwareCursorProvider cursorProvider;
+		agui::Gui gui;
+		agui::Button button;
+		agui::CheckBox checkBox;
+		agui::RadioButton radioButton;
+		agui::Label label;
+		agui::Label otherLabel;
+		agui::TextField textField;
+		agui::TextBox textBox;
+		agui::ListBox listBox;
+	public:
+		RenderScene(bool dirty, bool batching)
+			: graphics(320,240)
+		{
+			gui.setGraphics(&graphics);
+			gui.setInput(&input);
+			gui.setCursorProvider(&cursorProvider);
+			gui.getTop()->setSize(320,240);
+			gui.setDirtyRendering(dirty);
+			gui.setBatchingDrawCommands(batching);
+
+			button.setText("Toggle");
+			button.setToggleButton(true);
+			button.setSize(80,26);
+			button.setLocation(10,10);
+			gui.add(&button);
+
+			checkBox.setText("Check");
+			checkBox.setAutosizing(true);
+			checkBox.setLocation(10,46);
+			gui.add(&checkBox);
+
+			radioButton.setText("Radio");
+			radioButton.setAutosizing(true);
+			radioButton.setLocation(10,76);
+			gui.add(&radioButton);
+
+			label.setText("Label");
+			label.setSize(70,20);
+			label.setLocation(10,106);
+			gui.add(&label);
+
+			otherLabel.setText("Other");
+			otherLabel.setSize(70,20);
+			otherLabel.setLocation(85,106);
+			gui.add(&otherLabel);
+
+			textField.setSize(140,26);
+			textField.setLocation(10,134);
+			gui.add(&textField);
+
+			textBox.setSize(140,60);
+			textBox.setLocation(10,170);
+			gui.add(&textBox);
+
+			listBox.setSize(140,220);
+			listBox.setLocation(170,10);
+			for(int i = 0; i < 20; ++i)
+			{
+				char item[16];
+				sprintf(item,"Item %d",i);
+				listBox.addItem(item);
+			}
+			gui.add(&listBox);
+		}
+
+		void change(int frame)
+		{
+			switch(frame % 9)
+			{
+			case 0:
+				checkBox.setChecked(!checkBox.checked());
+				break;
+			case 1:
+				textField.setText(frame % 2 == 0 ? "Hello" : "Other text");
+				break;
+			case 2:
+				button.setToggleState(!button.isToggled());
+				break;
+			case 3:
+				radioButton.setChecked(!radioButton.checked());
+				break;
+			case 4:
+				label.setAlignment(frame % 2 == 0 ?
+					agui::ALIGN_TOP_LEFT : agui::ALIGN_MIDDLE_RIGHT);
+				break;
+			case 5:
+				textBox.appendText("line\n",false,false);
+				break;
+			case 6:
+				listBox.setSelectedIndex(frame % listBox.getLength());
+				break;
+			case 7:
+				textField.setSelection(0,3);
+				textBox.setSelection(0,4);
+				break;
+			case 8:
+				//two separate damaged rectangles in the same frame
+				label.setText(frame % 2 == 0 ? "First" : "Label");
+				otherLabel.setText(frame % 2 == 0 ? "Second" : "Other");
+				break;
+			}
+		}
+
+		void render()
+		{
+			input.advanceTime(1.0 / 60.0);
+			gui.logic();
+			if(!gui.isDirtyRendering())
+			{
+				graphics.clear(gui.getTop()->getBackColor());
+			}
+			gui.render();
+		}
+
+		int getPaintedWidgetCount() const
+		{
+			return gui.getPaintedWidgetCount();
+		}
+
+		bool hasDamage() const
+		{
+			return gui.isDirtyRendering() && gui.hasDamage();
+		}
+
+		const agui::SoftwareImage& getDisplay()
+		{
+			return graphics.getDisplay();
+		}
+	};
+
+	const int spriteCount = 24;
+
+	//every sixth sprite is drawn outside of the clipping rectangle
+	bool isCulledSprite(int sprite)
+	{
+		return sprite % 6 == 5;
+	}
+
+	void drawSprites(agui::SoftwareGraphics &graphics,
+		const std::vector<agui::SoftwareImage*> &images)
+	{
+		graphics.clear(agui::Color(40,40,40));
+		graphics.resetSpriteBatchCounters();
+		graphics.pushClippingRect(agui::Rectangle(0,0,100,100));
+
+		for(int i = 0; i < spriteCount; ++i)
+		{
+			agui::Point position((i % 8) * 11 + 2,(i / 8) * 11 + 2);
+			if(isCulledSprite(i))
+			{
+				position = agui::Point(104 + i,position.getY());
+			}
+
+			graphics.drawImage(images[i % images.size()],position,0.8f);
+
+			if(i == spriteCount / 2)
+			{
+				graphics.drawFilledRectangle(agui::Rectangle(10,5,40,20),
+					agui::Color(200,30,30,128));
+			}
+		}
+
+		graphics.flush();
+		graphics.popClippingRect();
+	}
+
+	int checkSpriteBatching()
+	{
+		agui::SoftwareImageAtlas atlas(128,128,1);
+		std::vector<agui::SoftwareImage*> images;
+		for(int i = 0; i < 4; ++i)
+		{
+			agui::SoftwareImage* image = new agui::SoftwareImage(10 + i,9 + i);
+			for(int y = 0; y < image->getHeight(); ++y)
+			{
+				for(int x = 0; x < image->getWidth(); ++x)
+				{
+					image->setPixel(x,y,agui::Color((x * 37 + i * 60) % 256,
+						(y * 53) % 256,(x * y + i * 90) % 256,(x + y) * 8 + 50));
+				}
+			}
+			images.push_back(image);
+			atlas.add(image);
+		}
+		atlas.build();
+
+		agui::SoftwareGraphics batched(160,120);
+		agui::SoftwareGraphics unbatched(160,120);
+		batched.setSpriteBatching(true);
+		unbatched.setSpriteBatching(false);
+		drawSprites(batched,images);
+		drawSprites(unbatched,images);
+
+		int culled = 0;
+		for(int i = 0; i < spriteCount; ++i)
+		{
+			if(isCulledSprite(i))
+			{
+				culled++;
+			}
+		}
+
+		int failures = 0;
+		if(atlas.getPageCount() != 1)
+		{
+			printf("sprites: the atlas has %d pages instead of 1\n",
+				atlas.getPageCount());
+			failures++;
+		}
+
+		//one batch before the rectangle and one after it
+		if(batched.getSpriteBatchCount() != 2)
+		{
+			printf("sprites: batching drew %d batches instead of 2\n",
+				batched.getSpriteBatchCount());
+			failures++;
+		}
+
+		if(unbatched.getSpriteBatchCount() != spriteCount - culled)
+		{
+			printf("sprites: without batching %d batches were drawn instead of %d\n",
+				unbatched.getSpriteBatchCount(),spriteCount - culled);
+			failures++;
+		}
+
+		if(batched.getCulledSpriteCount() != culled ||
+			unbatched.getCulledSpriteCount() != culled)
+		{
+			printf("sprites: %d and %d sprites were culled instead of %d\n",
+				batched.getCulledSpriteCount(),
+				unbatched.getCulledSpriteCount(),culled);
+			failures++;
+		}
+
+		if(!batched.getDisplay().hasSamePixels(unbatched.getDisplay()))
+		{
+			printf("sprites: batched sprites differ from unbatched ones\n");
+			failures++;
+		}
+
+		for(size_t i = 0; i < images.size(); ++i)
+		{
+			delete images[i];
+		}
+
+		return failures;
+	}
+
+	agui::Color patternColor(int x, int y)
+	{
+		return agui::Color((x * 7) % 256,(y * 13) % 256,(x ^ y) % 256,
+			(x + y) % 200 + 50);
+	}
+
+	int checkImageLocking()
+	{
+		int failures = 0;
+
+		agui::SoftwareImage perPixel(40,30);
+		agui::SoftwareImage locked(40,30);
+		for(int y = 0; y < perPixel.getHeight(); ++y)
+		{
+			for(int x = 0; x < perPixel.getWidth(); ++x)
+			{
+				perPixel.setPixel(x,y,patternColor(x,y));
+			}
+		}
+
+		locked.lock(agui::LOCK_WRITE_ONLY);
+		agui::PixelSpan pixels = locked.getLockedPixels();
+		for(int y = 0; y < pixels.getHeight(); ++y)
+		{
+			for(int x = 0; x < pixels.getWidth(); ++x)
+			{
+				pixels.setPixel(x,y,patternColor(x,y));
+			}
+		}
+		locked.unlock();
+
+		if(!locked.hasSamePixels(perPixel))
+		{
+			printf("locking: pixels written through a lock differ from setPixel\n");
+			failures++;
+		}
+
+		//an atlased image shares its page with the image placed before it
+		agui::SoftwareImageAtlas atlas(128,128,1);
+		agui::SoftwareImage neighbour(20,20);
+		neighbour.fill(agui::Color(0,0,255));
+		agui::SoftwareImage atlased(40,30);
+		atlased.blit(&perPixel,agui::Point(0,0));
+		atlas.add(&neighbour);
+		atlas.add(&atlased);
+		atlas.build();
+
+		const agui::Rectangle region(5,4,12,9);
+		atlased.lock(region);
+		atlased.getLockedPixels().fill(agui::Color(0,255,0));
+		atlased.unlock();
+
+		int wrongPixels = 0;
+		for(int y = 0; y < atlased.getHeight(); ++y)
+		{
+			for(int x = 0; x < atlased.getWidth(); ++x)
+			{
+				agui::Color expected = region.pointInside(agui::Point(x,y)) ?
+					agui::Color(0,255,0) : patternColor(x,y);
+				agui::Color actual = atlased.getPixel(x,y);
+				if(actual.getR() != expected.getR() ||
+					actual.getG() != expected.getG() ||
+					actual.getB() != expected.getB() ||
+					actual.getA() != expected.getA())
+				{
+					wrongPixels++;
+				}
+			}
+		}
+
+		for(int y = 0; y < neighbour.getHeight(); ++y)
+		{
+			for(int x = 0; x < neighbour.getWidth(); ++x)
+			{
+				if(neighbour.getPixel(x,y).getB() != 1.0f)
+				{
+					wrongPixels++;
+				}
+			}
+		}
+
+		if(wrongPixels > 0)
+		{
+			printf("locking: %d pixels of the atlas page are wrong after filling a locked region\n",
+				wrongPixels);
+			failures++;
+		}
+
+		locked.lock(agui::LOCK_READ_ONLY);
+		bool threw = false;
+		try
+		{
+			locked.setPixel(0,0,agui::Color(0,0,0));
+		}
+		catch(agui::Exception &)
+		{
+			threw = true;
+		}
+		locked.unlock();
+
+		if(!threw)
+		{
+			printf("locking: an image locked for reading accepted a write\n");
+			failures++;
+		}
+
+		return failures;
+	}
+}
+
+int main()
+{
+	agui::SoftwareFont font("builtin",16);
+	agui::Widget::setGlobalFont(&font);
+
+	RenderScene reference(false,false);
+	RenderScene dirty(true,false);
+	RenderScene batched(false,true);
+	RenderScene dirtyBatched(true,true);
+	RenderScene* scenes[] = {&dirty,&batched,&dirtyBatched};
+	const char* names[] = {"dirty","batched","dirty batched"};
+
+	const int changedFrames = 54;
+	const int frames = changedFrames + 4;
+
+	int failures = 0;
+	for(int frame = 0; frame < frames; ++frame)
+	{
+		if(frame < changedFrames)
+		{
+			reference.change(frame);
+		}
+		reference.render();
+
+		for(int i = 0; i < 3; ++i)
+		{
+			if(frame < changedFrames)
+			{
+				scenes[i]->change(frame);
+			}
+			scenes[i]->render();
+
+			if(!scenes[i]->getDisplay().hasSamePixels(reference.getDisplay()))
+			{
+				printf("frame %d: %s rendering differs from a full repaint\n",
+					frame,names[i]);
+				failures++;
+			}
+
+			if(scenes[i]->hasDamage())
+			{
+				printf("frame %d: %s rendering added damage while painting\n",
+					frame,names[i]);
+				failures++;
+			}
+
+			if(frame >= changedFrames && scenes[i]->getPaintedWidgetCount() != 0)
+			{
+				printf("frame %d: %s rendering painted %d widgets of an unchanged frame\n",
+					frame,names[i],scenes[i]->getPaintedWidgetCount());
+				failures++;
+			}
+		}
+	}
+
+	failures += checkSpriteBatching();
+	failures += checkImageLocking();
+
+	if(failures > 0)
+	{
+		printf("%d checks failed\n",failures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}